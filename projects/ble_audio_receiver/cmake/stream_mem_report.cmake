@@ -0,0 +1,44 @@
+#
+# Post-build report of the RAM owned by per-stream state.
+#
+# Usage: cmake -DNM=<nm> -DELF=<zephyr.elf> -DSNK=<count> -DSRC=<count> -P stream_mem_report.cmake
+#
+
+# Symbols whose size scales with the sink/source ASE counts
+set(stream_symbols
+    sink_ases
+    source_ases
+    rx_streams
+    tx_streams
+    ctrl_streams
+    nlms
+    sdu_pool
+    tx_pool
+)
+
+execute_process(COMMAND ${NM} --print-size --radix=d ${ELF}
+                OUTPUT_VARIABLE nm_output
+                RESULT_VARIABLE nm_result)
+if(NOT nm_result EQUAL 0)
+  message(WARNING "stream_mem_report: ${NM} failed on ${ELF}")
+  return()
+endif()
+
+string(REPLACE "\n" ";" nm_lines "${nm_output}")
+
+set(total 0)
+message(STATUS "Per-stream RAM (${SNK} sink, ${SRC} source ASEs):")
+foreach(symbol ${stream_symbols})
+  set(symbol_size 0)
+  foreach(line ${nm_lines})
+    # "<addr> <size> <type> <name>", net_buf pools expand to _net_buf_<pool> and net_buf_data_<pool>
+    if(line MATCHES "^[0-9]+ ([0-9]+) [bBdD] (_?net_buf_(data_)?)?${symbol}$")
+      math(EXPR symbol_size "${symbol_size} + ${CMAKE_MATCH_1}")
+    endif()
+  endforeach()
+  if(symbol_size GREATER 0)
+    message(STATUS "  ${symbol}: ${symbol_size} B")
+    math(EXPR total "${total} + ${symbol_size}")
+  endif()
+endforeach()
+message(STATUS "  total: ${total} B")
@@ -0,0 +1,206 @@
+// --- includes ----------------------------------------------------------------
+#include "audio_aec.h"
+
+#include "audio_rx.h"
+#include "audio_tx.h"
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+
+// --- defines -----------------------------------------------------------------
+#define NLMS_MU  (CONFIG_AUDIO_AEC_NLMS_MU_PERMILL / 1000.0f)
+#define NLMS_EPS 1.0f
+
+// --- structs -----------------------------------------------------------------
+struct ref_slot
+{
+    bool     valid;
+    uint32_t ts;
+    uint32_t duration_us;
+    uint32_t sample_rate_hz;
+    uint16_t samples;
+    int16_t  pcm[AUDIO_MAX_NUM_SAMPLES];
+};
+
+struct nlms_state
+{
+    float  weights[CONFIG_AUDIO_AEC_NLMS_TAPS];
+    float  history[CONFIG_AUDIO_AEC_NLMS_TAPS];
+    size_t pos;
+    float  power;
+};
+
+// --- static functions declarations -------------------------------------------
+static struct ref_slot *ref_slot_claim(uint32_t render_ts, uint32_t duration_us);
+static struct ref_slot *ref_slot_find(uint32_t ts);
+
+// --- static variables definitions --------------------------------------------
+static struct ref_slot   ref_slots[CONFIG_AUDIO_AEC_REF_FRAMES];
+static struct nlms_state nlms[AUDIO_TX_STREAM_COUNT];
+
+// --- static functions definitions --------------------------------------------
+static struct ref_slot *
+ref_slot_claim(uint32_t render_ts, uint32_t duration_us)
+{
+    struct ref_slot *oldest = &ref_slots[0];
+
+    for (size_t i = 0U; i < ARRAY_SIZE(ref_slots); i++)
+    {
+        struct ref_slot *slot = &ref_slots[i];
+
+        if (!slot->valid)
+        {
+            oldest = slot;
+            continue;
+        }
+
+        /* Streams of the same CIG share the reference point, mix them into one slot */
+        if ((uint32_t)abs((int32_t)(render_ts - slot->ts)) < (duration_us / 2U))
+        {
+            return slot;
+        }
+
+        if (oldest->valid && (int32_t)(slot->ts - oldest->ts) < 0)
+        {
+            oldest = slot;
+        }
+    }
+
+    oldest->valid = false;
+    return oldest;
+}
+
+static struct ref_slot *
+ref_slot_find(uint32_t ts)
+{
+    for (size_t i = 0U; i < ARRAY_SIZE(ref_slots); i++)
+    {
+        struct ref_slot *slot = &ref_slots[i];
+
+        if (slot->valid && (ts - slot->ts) < slot->duration_us)
+        {
+            return slot;
+        }
+    }
+
+    return NULL;
+}
+
+// --- functions definitions ---------------------------------------------------
+void
+audio_aec_ref_put(uint32_t render_ts, const int16_t *pcm, size_t samples, uint32_t sample_rate_hz)
+{
+    const uint32_t   duration_us = (uint32_t)((samples * USEC_PER_SEC) / sample_rate_hz);
+    struct ref_slot *slot;
+
+    __ASSERT(samples <= AUDIO_MAX_NUM_SAMPLES, "Frame of %zu samples too long", samples);
+
+    slot = ref_slot_claim(render_ts, duration_us);
+    if (!slot->valid || slot->samples != samples || slot->sample_rate_hz != sample_rate_hz)
+    {
+        slot->valid          = true;
+        slot->ts             = render_ts;
+        slot->duration_us    = duration_us;
+        slot->sample_rate_hz = sample_rate_hz;
+        slot->samples        = samples;
+        memcpy(slot->pcm, pcm, samples * sizeof(pcm[0]));
+        return;
+    }
+
+    for (size_t i = 0U; i < samples; i++)
+    {
+        slot->pcm[i] = CLAMP(slot->pcm[i] + pcm[i], INT16_MIN, INT16_MAX);
+    }
+}
+
+int
+audio_aec_ref_get(uint32_t ts, int16_t *pcm, size_t samples, uint32_t sample_rate_hz)
+{
+    size_t done = 0U;
+
+    while (done < samples)
+    {
+        const uint32_t         t    = ts + (uint32_t)(((uint64_t)done * USEC_PER_SEC) / sample_rate_hz);
+        const struct ref_slot *slot = ref_slot_find(t);
+        size_t                 offset;
+        size_t                 count;
+
+        if (slot != NULL && slot->sample_rate_hz != sample_rate_hz)
+        {
+            /* Rendered at another rate, the reference would need resampling */
+            memset(pcm, 0, samples * sizeof(pcm[0]));
+            return -ENODATA;
+        }
+
+        /* Rounding may place the offset just past the end of the slot */
+        offset = (slot != NULL) ? (size_t)(((uint64_t)(t - slot->ts) * sample_rate_hz) / USEC_PER_SEC) : 0U;
+        if (slot == NULL || offset >= slot->samples)
+        {
+            /* Nothing was rendered at that time */
+            memset(&pcm[done], 0, (samples - done) * sizeof(pcm[0]));
+            return (done == 0U) ? -ENODATA : 0;
+        }
+
+        count  = MIN(slot->samples - offset, samples - done);
+        memcpy(&pcm[done], &slot->pcm[offset], count * sizeof(pcm[0]));
+        done += count;
+    }
+
+    return 0;
+}
+
+void
+audio_aec_ref_reset(void)
+{
+    for (size_t i = 0U; i < ARRAY_SIZE(ref_slots); i++)
+    {
+        ref_slots[i].valid = false;
+    }
+}
+
+void
+audio_aec_process(uint8_t channel, const int16_t *mic, const int16_t *ref, int16_t *out, size_t samples)
+{
+    struct nlms_state *state;
+
+    __ASSERT(channel < ARRAY_SIZE(nlms), "Invalid channel %u", channel);
+    state = &nlms[channel];
+
+    /* Placeholder echo canceller: a short NLMS filter that models the direct
+     * echo path from the far-end reference to the microphone.
+     */
+    for (size_t n = 0U; n < samples; n++)
+    {
+        const float x_old = state->history[state->pos];
+        float       echo  = 0.0f;
+        float       err;
+        float       step;
+        size_t      k;
+
+        state->history[state->pos] = (float)ref[n];
+        state->power += ((float)ref[n] * (float)ref[n]) - (x_old * x_old);
+        state->power = MAX(state->power, 0.0f);
+
+        k = state->pos;
+        for (size_t i = 0U; i < ARRAY_SIZE(state->weights); i++)
+        {
+            echo += state->weights[i] * state->history[k];
+            k = (k == 0U) ? (ARRAY_SIZE(state->history) - 1U) : (k - 1U);
+        }
+
+        err    = (float)mic[n] - echo;
+        out[n] = (int16_t)CLAMP(err, (float)INT16_MIN, (float)INT16_MAX);
+
+        step = (NLMS_MU * err) / (state->power + NLMS_EPS);
+        k    = state->pos;
+        for (size_t i = 0U; i < ARRAY_SIZE(state->weights); i++)
+        {
+            state->weights[i] += step * state->history[k];
+            k = (k == 0U) ? (ARRAY_SIZE(state->history) - 1U) : (k - 1U);
+        }
+
+        state->pos = (state->pos + 1U) % ARRAY_SIZE(state->history);
+    }
+}
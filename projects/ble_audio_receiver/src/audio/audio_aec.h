@@ -0,0 +1,14 @@
+#ifndef AUDIO_AEC_H
+#define AUDIO_AEC_H
+
+// --- includes ----------------------------------------------------------------
+#include <stddef.h>
+#include <stdint.h>
+
+// --- functions declarations --------------------------------------------------
+void audio_aec_ref_put(uint32_t render_ts, const int16_t *pcm, size_t samples, uint32_t sample_rate_hz);
+int  audio_aec_ref_get(uint32_t ts, int16_t *pcm, size_t samples, uint32_t sample_rate_hz);
+void audio_aec_ref_reset(void);
+void audio_aec_process(uint8_t channel, const int16_t *mic, const int16_t *ref, int16_t *out, size_t samples);
+
+#endif // AUDIO_AEC_H
@@ -0,0 +1,110 @@
+// --- includes ----------------------------------------------------------------
+#include "audio_clock.h"
+
+#include <zephyr/kernel.h>
+
+// --- static functions declarations -------------------------------------------
+static void     tick_timer_expiry(struct k_timer *timer);
+static uint32_t local_now_us(void);
+
+// --- static variables definitions --------------------------------------------
+static K_SEM_DEFINE(tick_sem, 0U, 1U);
+static K_TIMER_DEFINE(tick_timer, tick_timer_expiry, NULL);
+
+static struct k_spinlock clock_lock;
+static bool              clock_synced;
+/* Offset from the local microsecond counter to the ISO timeline */
+static uint32_t          clock_offset_us;
+
+static atomic_t tick_users;
+static uint32_t tick_interval_us;
+
+// --- static functions definitions --------------------------------------------
+static void
+tick_timer_expiry(struct k_timer *timer)
+{
+    k_sem_give(&tick_sem);
+}
+
+static uint32_t
+local_now_us(void)
+{
+    return (uint32_t)k_ticks_to_us_floor64(k_uptime_ticks());
+}
+
+// --- functions definitions ---------------------------------------------------
+void
+audio_clock_sync(uint32_t iso_ts_us)
+{
+    const uint32_t   offset = iso_ts_us - local_now_us();
+    k_spinlock_key_t key    = k_spin_lock(&clock_lock);
+
+    /* An SDU is only ever delivered after its reference point, so the offset
+     * seen with the lowest delivery latency is the most accurate one. Leak
+     * 1 us per SDU to follow a local clock that runs faster than the ISO one.
+     */
+    if (!clock_synced || (int32_t)(offset - clock_offset_us) > 0)
+    {
+        clock_offset_us = offset;
+        clock_synced    = true;
+    }
+    else
+    {
+        clock_offset_us--;
+    }
+
+    k_spin_unlock(&clock_lock, key);
+}
+
+bool
+audio_clock_is_synced(void)
+{
+    return clock_synced;
+}
+
+uint32_t
+audio_clock_now(void)
+{
+    uint32_t         now;
+    k_spinlock_key_t key = k_spin_lock(&clock_lock);
+
+    now = local_now_us() + clock_offset_us;
+    k_spin_unlock(&clock_lock, key);
+
+    return now;
+}
+
+void
+audio_clock_tick_start(uint32_t interval_us)
+{
+    /* First user paces the whole pipeline */
+    if (atomic_inc(&tick_users) == 0)
+    {
+        tick_interval_us = interval_us;
+        k_timer_start(&tick_timer, K_USEC(interval_us), K_USEC(interval_us));
+    }
+}
+
+void
+audio_clock_tick_stop(void)
+{
+    if (atomic_dec(&tick_users) == 1)
+    {
+        k_timer_stop(&tick_timer);
+
+        /* Resync from the next stream, the ISO timeline may restart */
+        clock_synced = false;
+    }
+}
+
+void
+audio_clock_tick_wait(void)
+{
+    k_sem_take(&tick_sem, K_FOREVER);
+}
+
+uint32_t
+audio_clock_tick_interval_get(void)
+{
+    return tick_interval_us;
+}
@@ -0,0 +1,18 @@
+#ifndef AUDIO_CLOCK_H
+#define AUDIO_CLOCK_H
+
+// --- includes ----------------------------------------------------------------
+#include <stdbool.h>
+#include <stdint.h>
+
+// --- functions declarations --------------------------------------------------
+void     audio_clock_sync(uint32_t iso_ts_us);
+bool     audio_clock_is_synced(void);
+uint32_t audio_clock_now(void);
+
+void     audio_clock_tick_start(uint32_t interval_us);
+void     audio_clock_tick_stop(void);
+void     audio_clock_tick_wait(void);
+uint32_t audio_clock_tick_interval_get(void);
+
+#endif // AUDIO_CLOCK_H
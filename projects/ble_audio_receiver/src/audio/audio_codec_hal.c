@@ -0,0 +1,39 @@
+// --- includes ----------------------------------------------------------------
+#include "audio_codec_hal.h"
+
+// --- functions definitions ---------------------------------------------------
+lc3_decoder_t
+audio_codec_hal_decoder_setup(int frame_duration_us, int freq_hz, audio_decoder_mem_t *mem)
+{
+    return lc3_setup_decoder(frame_duration_us,
+                             freq_hz,
+                             0, /* No resampling */
+                             mem);
+}
+
+lc3_encoder_t
+audio_codec_hal_encoder_setup(int frame_duration_us, int freq_hz, audio_encoder_mem_t *mem)
+{
+    return lc3_setup_encoder(frame_duration_us,
+                             freq_hz,
+                             0, /* No resampling */
+                             mem);
+}
+
+int
+audio_codec_hal_decode(lc3_decoder_t decoder, const void *in, int nbytes, int16_t *pcm)
+{
+    return lc3_decode(decoder, in, nbytes, LC3_PCM_FORMAT_S16, pcm, 1);
+}
+
+int
+audio_codec_hal_encode(lc3_encoder_t encoder, const int16_t *pcm, int nbytes, void *out)
+{
+    return lc3_encode(encoder, LC3_PCM_FORMAT_S16, pcm, 1, nbytes, out);
+}
+
+int
+audio_codec_hal_frame_samples(int frame_duration_us, int freq_hz)
+{
+    return lc3_frame_samples(frame_duration_us, freq_hz);
+}
@@ -0,0 +1,19 @@
+#ifndef AUDIO_CODEC_HAL_H
+#define AUDIO_CODEC_HAL_H
+
+// --- includes ----------------------------------------------------------------
+#include "audio_codec_profile.h"
+
+#include <stdint.h>
+
+// --- functions declarations --------------------------------------------------
+/* Thin adapter over liblc3, one S16 mono frame per call. Host builds link
+ * fakes of these functions instead of the codec.
+ */
+lc3_decoder_t audio_codec_hal_decoder_setup(int frame_duration_us, int freq_hz, audio_decoder_mem_t *mem);
+lc3_encoder_t audio_codec_hal_encoder_setup(int frame_duration_us, int freq_hz, audio_encoder_mem_t *mem);
+int           audio_codec_hal_decode(lc3_decoder_t decoder, const void *in, int nbytes, int16_t *pcm);
+int           audio_codec_hal_encode(lc3_encoder_t encoder, const int16_t *pcm, int nbytes, void *out);
+int           audio_codec_hal_frame_samples(int frame_duration_us, int freq_hz);
+
+#endif // AUDIO_CODEC_HAL_H
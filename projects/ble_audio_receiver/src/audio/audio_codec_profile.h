@@ -0,0 +1,57 @@
+#ifndef AUDIO_CODEC_PROFILE_H
+#define AUDIO_CODEC_PROFILE_H
+
+// --- includes ----------------------------------------------------------------
+#include "lc3.h"
+
+#include <zephyr/bluetooth/audio/audio.h>
+#include <zephyr/sys_clock.h>
+#include <zephyr/toolchain.h>
+
+// --- defines -----------------------------------------------------------------
+#if defined(CONFIG_AUDIO_CODEC_PROFILE_FIXED)
+#define AUDIO_CODEC_FREQ_HZ           CONFIG_AUDIO_CODEC_FIXED_FREQ_HZ
+#define AUDIO_CODEC_FRAME_DURATION_US CONFIG_AUDIO_CODEC_FIXED_FRAME_DURATION_US
+#define AUDIO_CODEC_OCTETS_PER_FRAME  CONFIG_AUDIO_CODEC_FIXED_OCTETS_PER_FRAME
+#define AUDIO_CODEC_FRAMES_PER_SDU    CONFIG_AUDIO_CODEC_FIXED_FRAMES_PER_SDU
+#define AUDIO_CODEC_SDU_LEN           (AUDIO_CODEC_OCTETS_PER_FRAME * AUDIO_CODEC_FRAMES_PER_SDU)
+
+/* PACS must not advertise an SDU that the ISO channels cannot carry */
+BUILD_ASSERT(AUDIO_CODEC_SDU_LEN <= CONFIG_BT_ISO_TX_MTU && AUDIO_CODEC_SDU_LEN <= CONFIG_BT_ISO_RX_MTU,
+             "Fixed codec profile SDU exceeds the ISO MTU");
+
+#if defined(CONFIG_AUDIO_CODEC_FIXED_FREQ_16KHZ)
+#define AUDIO_CODEC_CAP_FREQ BT_AUDIO_CODEC_CAP_FREQ_16KHZ
+#elif defined(CONFIG_AUDIO_CODEC_FIXED_FREQ_24KHZ)
+#define AUDIO_CODEC_CAP_FREQ BT_AUDIO_CODEC_CAP_FREQ_24KHZ
+#elif defined(CONFIG_AUDIO_CODEC_FIXED_FREQ_32KHZ)
+#define AUDIO_CODEC_CAP_FREQ BT_AUDIO_CODEC_CAP_FREQ_32KHZ
+#else
+#define AUDIO_CODEC_CAP_FREQ BT_AUDIO_CODEC_CAP_FREQ_48KHZ
+#endif
+
+#if defined(CONFIG_AUDIO_CODEC_FIXED_DURATION_7_5)
+#define AUDIO_CODEC_CAP_DURATION BT_AUDIO_CODEC_CAP_DURATION_7_5
+#else
+#define AUDIO_CODEC_CAP_DURATION BT_AUDIO_CODEC_CAP_DURATION_10
+#endif
+
+#define AUDIO_MAX_SAMPLE_RATE       AUDIO_CODEC_FREQ_HZ
+#define AUDIO_MAX_FRAME_DURATION_US AUDIO_CODEC_FRAME_DURATION_US
+#define AUDIO_MAX_SDU_LEN           AUDIO_CODEC_SDU_LEN
+
+/* Codec memory sized for the profile instead of the worst case */
+typedef LC3_DECODER_MEM_T(AUDIO_CODEC_FRAME_DURATION_US, AUDIO_CODEC_FREQ_HZ) audio_decoder_mem_t;
+typedef LC3_ENCODER_MEM_T(AUDIO_CODEC_FRAME_DURATION_US, AUDIO_CODEC_FREQ_HZ) audio_encoder_mem_t;
+#else
+#define AUDIO_MAX_SAMPLE_RATE       48000
+#define AUDIO_MAX_FRAME_DURATION_US 10000
+#define AUDIO_MAX_SDU_LEN           CONFIG_AUDIO_RX_SDU_MAX_LEN
+
+typedef lc3_decoder_mem_48k_t audio_decoder_mem_t;
+typedef lc3_encoder_mem_48k_t audio_encoder_mem_t;
+#endif
+
+#define AUDIO_MAX_NUM_SAMPLES ((AUDIO_MAX_FRAME_DURATION_US * AUDIO_MAX_SAMPLE_RATE) / USEC_PER_SEC)
+
+#endif // AUDIO_CODEC_PROFILE_H
@@ -0,0 +1,307 @@
+// --- includes ----------------------------------------------------------------
+#include "audio_latency_ctrl.h"
+
+#include "audio_rx.h"
+
+#include <stdlib.h>
+#include <zephyr/bluetooth/iso.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+
+// --- logging settings --------------------------------------------------------
+LOG_MODULE_DECLARE(audio_m);
+
+// --- defines -----------------------------------------------------------------
+#define RTN_MIN 1U
+
+// --- structs -----------------------------------------------------------------
+enum link_class
+{
+    LINK_CLASS_GOOD,
+    LINK_CLASS_FAIR,
+    LINK_CLASS_BAD,
+};
+
+struct link_window
+{
+    uint32_t sdus;
+    uint32_t lost;
+    uint32_t plc_frames;
+    uint32_t underruns;
+    uint32_t jitter_us;
+};
+
+struct ctrl_stream
+{
+    bool               active;
+    bt_addr_le_t       peer;
+    uint32_t           sdu_interval_us;
+    uint32_t           pd_us;
+    uint32_t           render_delay_us;
+    uint8_t            rtn;
+    uint8_t            good_windows;
+    bool               have_last;
+    uint16_t           last_seq_num;
+    uint32_t           last_ts;
+    struct link_window win;
+};
+
+struct peer_pref
+{
+    bool         valid;
+    bt_addr_le_t addr;
+    uint8_t      rtn;
+    uint32_t     pd_us;
+};
+
+// --- static functions declarations -------------------------------------------
+static struct peer_pref *peer_find(const bt_addr_le_t *peer);
+static enum link_class   link_classify(const struct ctrl_stream *ctrl);
+static void              window_evaluate(uint8_t stream_idx);
+
+// --- static variables definitions --------------------------------------------
+static struct k_spinlock  ctrl_lock;
+static struct ctrl_stream ctrl_streams[AUDIO_RX_STREAM_COUNT];
+static struct peer_pref   peers[CONFIG_AUDIO_LATENCY_CTRL_PEER_COUNT];
+static size_t             peer_next;
+
+// --- static functions definitions --------------------------------------------
+static struct peer_pref *
+peer_find(const bt_addr_le_t *peer)
+{
+    for (size_t i = 0U; i < ARRAY_SIZE(peers); i++)
+    {
+        if (peers[i].valid && bt_addr_le_cmp(&peers[i].addr, peer) == 0)
+        {
+            return &peers[i];
+        }
+    }
+
+    return NULL;
+}
+
+static enum link_class
+link_classify(const struct ctrl_stream *ctrl)
+{
+    const struct link_window *win          = &ctrl->win;
+    const uint32_t            loss_permill = (win->lost * 1000U) / MAX(win->sdus, 1U);
+    const uint32_t            plc_permill  = (win->plc_frames * 1000U) / MAX(win->sdus, 1U);
+
+    if (loss_permill > CONFIG_AUDIO_LATENCY_CTRL_LOSS_HIGH_PERMILL
+        || plc_permill > CONFIG_AUDIO_LATENCY_CTRL_LOSS_HIGH_PERMILL || win->underruns > (win->sdus / 20U)
+        || win->jitter_us > (ctrl->sdu_interval_us / 4U))
+    {
+        return LINK_CLASS_BAD;
+    }
+
+    if (loss_permill <= CONFIG_AUDIO_LATENCY_CTRL_LOSS_LOW_PERMILL
+        && plc_permill <= CONFIG_AUDIO_LATENCY_CTRL_LOSS_LOW_PERMILL && win->underruns == 0U
+        && win->jitter_us <= (ctrl->sdu_interval_us / 20U))
+    {
+        return LINK_CLASS_GOOD;
+    }
+
+    return LINK_CLASS_FAIR;
+}
+
+static void
+window_evaluate(uint8_t stream_idx)
+{
+    struct ctrl_stream *ctrl       = &ctrl_streams[stream_idx];
+    const uint32_t      prev_delay = ctrl->render_delay_us;
+    const uint8_t       prev_rtn   = ctrl->rtn;
+    const uint32_t      pd_min     = MIN(CONFIG_BLE_BAP_PD_MIN_US, ctrl->pd_us);
+
+    switch (link_classify(ctrl))
+    {
+        case LINK_CLASS_GOOD:
+            /* Only trade robustness for latency once the link proved to be stable */
+            ctrl->good_windows++;
+            if (ctrl->good_windows >= CONFIG_AUDIO_LATENCY_CTRL_GOOD_WINDOWS)
+            {
+                ctrl->good_windows = 0U;
+                ctrl->render_delay_us
+                    = MAX(ctrl->render_delay_us - MIN(ctrl->render_delay_us, CONFIG_AUDIO_LATENCY_CTRL_STEP_US),
+                          pd_min);
+                /* Never raise an RTN configured below the floor */
+                if (ctrl->rtn > RTN_MIN)
+                {
+                    ctrl->rtn--;
+                }
+            }
+            break;
+        case LINK_CLASS_BAD:
+            ctrl->good_windows    = 0U;
+            ctrl->render_delay_us = MIN(ctrl->render_delay_us + CONFIG_AUDIO_LATENCY_CTRL_STEP_US, ctrl->pd_us);
+            ctrl->rtn             = MIN(ctrl->rtn + 1U, CONFIG_AUDIO_LATENCY_CTRL_RTN_MAX);
+            break;
+        case LINK_CLASS_FAIR:
+        default:
+            ctrl->good_windows = 0U;
+            break;
+    }
+
+    if (ctrl->render_delay_us != prev_delay || ctrl->rtn != prev_rtn)
+    {
+        LOG_INF("Stream %u: lost %u plc %u underruns %u jitter %u us -> render delay %u us rtn %u",
+                stream_idx,
+                ctrl->win.lost,
+                ctrl->win.plc_frames,
+                ctrl->win.underruns,
+                ctrl->win.jitter_us,
+                ctrl->render_delay_us,
+                ctrl->rtn);
+    }
+
+    ctrl->win.sdus       = 0U;
+    ctrl->win.lost       = 0U;
+    ctrl->win.plc_frames = 0U;
+    ctrl->win.underruns  = 0U;
+}
+
+// --- functions definitions ---------------------------------------------------
+void
+audio_latency_ctrl_qos_pref_get(const bt_addr_le_t *peer, struct bt_audio_codec_qos_pref *pref)
+{
+    const struct peer_pref *entry;
+    k_spinlock_key_t        key = k_spin_lock(&ctrl_lock);
+
+    entry = peer_find(peer);
+    if (entry != NULL)
+    {
+        pref->rtn         = entry->rtn;
+        pref->pref_pd_min = CLAMP(entry->pd_us, pref->pd_min, pref->pd_max);
+        pref->pref_pd_max = pref->pref_pd_min;
+    }
+
+    k_spin_unlock(&ctrl_lock, key);
+}
+
+void
+audio_latency_ctrl_stream_start(uint8_t stream_idx, const bt_addr_le_t *peer, uint32_t sdu_interval_us, uint32_t pd_us)
+{
+    struct ctrl_stream     *ctrl;
+    const struct peer_pref *entry;
+    k_spinlock_key_t        key;
+
+    __ASSERT(stream_idx < ARRAY_SIZE(ctrl_streams), "Invalid stream index %u", stream_idx);
+    ctrl = &ctrl_streams[stream_idx];
+
+    key = k_spin_lock(&ctrl_lock);
+    entry = peer_find(peer);
+
+    *ctrl = (struct ctrl_stream) {
+        .active          = true,
+        .sdu_interval_us = sdu_interval_us,
+        .pd_us           = pd_us,
+        /* Start from what was learned about the peer, or conservatively */
+        .render_delay_us = (entry != NULL) ? MIN(entry->pd_us, pd_us) : pd_us,
+        .rtn             = (entry != NULL) ? entry->rtn : CONFIG_BLE_BAP_RTN,
+    };
+    bt_addr_le_copy(&ctrl->peer, peer);
+    k_spin_unlock(&ctrl_lock, key);
+}
+
+void
+audio_latency_ctrl_stream_stop(uint8_t stream_idx)
+{
+    struct ctrl_stream *ctrl;
+    struct peer_pref   *entry;
+    k_spinlock_key_t    key;
+
+    __ASSERT(stream_idx < ARRAY_SIZE(ctrl_streams), "Invalid stream index %u", stream_idx);
+    ctrl = &ctrl_streams[stream_idx];
+
+    key = k_spin_lock(&ctrl_lock);
+    if (!ctrl->active)
+    {
+        k_spin_unlock(&ctrl_lock, key);
+        return;
+    }
+
+    ctrl->active = false;
+
+    /* Remember the outcome so the next QoS configuration of this peer starts from it */
+    entry = peer_find(&ctrl->peer);
+    if (entry == NULL)
+    {
+        entry     = &peers[peer_next];
+        peer_next = (peer_next + 1U) % ARRAY_SIZE(peers);
+        bt_addr_le_copy(&entry->addr, &ctrl->peer);
+        entry->valid = true;
+    }
+
+    entry->rtn   = ctrl->rtn;
+    entry->pd_us = ctrl->render_delay_us;
+    k_spin_unlock(&ctrl_lock, key);
+}
+
+void
+audio_latency_ctrl_sdu(uint8_t  stream_idx,
+                       uint8_t  flags,
+                       uint16_t seq_num,
+                       uint32_t ts,
+                       int      plc_frames,
+                       uint32_t now_us)
+{
+    struct ctrl_stream *ctrl = &ctrl_streams[stream_idx];
+    uint16_t            gap  = 0U;
+    k_spinlock_key_t    key;
+
+    key = k_spin_lock(&ctrl_lock);
+    if (!ctrl->active)
+    {
+        k_spin_unlock(&ctrl_lock, key);
+        return;
+    }
+
+    if (ctrl->have_last)
+    {
+        /* SDUs dropped before reaching the decoder show up as sequence number gaps */
+        gap = seq_num - ctrl->last_seq_num - 1U;
+        if (gap > CONFIG_AUDIO_LATENCY_CTRL_WINDOW)
+        {
+            gap = 0U;
+        }
+
+        if ((flags & BT_ISO_FLAGS_TS) != 0)
+        {
+            const int32_t expected = ctrl->sdu_interval_us * (gap + 1U);
+            const int32_t dev      = abs((int32_t)(ts - ctrl->last_ts) - expected);
+
+            /* Peak detector with slow decay so a single late SDU is not forgotten at once */
+            ctrl->win.jitter_us = MAX(ctrl->win.jitter_us - (ctrl->win.jitter_us >> 3), (uint32_t)dev);
+        }
+    }
+
+    /* Decoded after its render time means the jitter buffer ran dry. Measured
+     * against the ISO timeline rather than per decode burst, as the decode
+     * tick is not phase-locked to SDU arrival.
+     */
+    if ((flags & BT_ISO_FLAGS_TS) != 0 && (int32_t)(ts + ctrl->render_delay_us - now_us) < 0)
+    {
+        ctrl->win.underruns++;
+    }
+
+    ctrl->have_last    = true;
+    ctrl->last_seq_num = seq_num;
+    ctrl->last_ts      = ts;
+
+    ctrl->win.sdus += 1U + gap;
+    ctrl->win.lost += gap + (((flags & BT_ISO_FLAGS_VALID) == 0) ? 1U : 0U);
+    ctrl->win.plc_frames += plc_frames;
+
+    if (ctrl->win.sdus >= CONFIG_AUDIO_LATENCY_CTRL_WINDOW)
+    {
+        window_evaluate(stream_idx);
+    }
+    k_spin_unlock(&ctrl_lock, key);
+}
+
+uint32_t
+audio_latency_ctrl_render_delay_get(uint8_t stream_idx)
+{
+    __ASSERT(stream_idx < ARRAY_SIZE(ctrl_streams), "Invalid stream index %u", stream_idx);
+
+    return ctrl_streams[stream_idx].render_delay_us;
+}
@@ -0,0 +1,48 @@
+#ifndef AUDIO_LATENCY_CTRL_H
+#define AUDIO_LATENCY_CTRL_H
+
+// --- includes ----------------------------------------------------------------
+#include <stdint.h>
+#include <zephyr/bluetooth/addr.h>
+#include <zephyr/bluetooth/audio/audio.h>
+
+// --- functions declarations --------------------------------------------------
+#if defined(CONFIG_AUDIO_LATENCY_CTRL)
+void     audio_latency_ctrl_qos_pref_get(const bt_addr_le_t *peer, struct bt_audio_codec_qos_pref *pref);
+void     audio_latency_ctrl_stream_start(uint8_t             stream_idx,
+                                         const bt_addr_le_t *peer,
+                                         uint32_t            sdu_interval_us,
+                                         uint32_t            pd_us);
+void     audio_latency_ctrl_stream_stop(uint8_t stream_idx);
+void     audio_latency_ctrl_sdu(uint8_t  stream_idx,
+                                uint8_t  flags,
+                                uint16_t seq_num,
+                                uint32_t ts,
+                                int      plc_frames,
+                                uint32_t now_us);
+uint32_t audio_latency_ctrl_render_delay_get(uint8_t stream_idx);
+#else
+static inline void
+audio_latency_ctrl_qos_pref_get(const bt_addr_le_t *peer, struct bt_audio_codec_qos_pref *pref)
+{
+}
+static inline void
+audio_latency_ctrl_stream_start(uint8_t stream_idx, const bt_addr_le_t *peer, uint32_t sdu_interval_us, uint32_t pd_us)
+{
+}
+static inline void
+audio_latency_ctrl_stream_stop(uint8_t stream_idx)
+{
+}
+static inline void
+audio_latency_ctrl_sdu(uint8_t  stream_idx,
+                       uint8_t  flags,
+                       uint16_t seq_num,
+                       uint32_t ts,
+                       int      plc_frames,
+                       uint32_t now_us)
+{
+}
+#endif
+
+#endif // AUDIO_LATENCY_CTRL_H
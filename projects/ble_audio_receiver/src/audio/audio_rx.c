@@ -0,0 +1,491 @@
+// --- includes ----------------------------------------------------------------
+#include "audio_rx.h"
+
+#include "audio_aec.h"
+#include "audio_clock.h"
+#include "audio_codec_hal.h"
+#include "audio_latency_ctrl.h"
+#include "audio_tx.h"
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+
+// --- logging settings --------------------------------------------------------
+LOG_MODULE_REGISTER(audio_m, LOG_LEVEL_INF);
+
+// --- structs -----------------------------------------------------------------
+struct sdu_meta
+{
+    uint8_t  stream_idx;
+    uint8_t  flags;
+    uint16_t seq_num;
+    uint32_t ts;
+};
+
+struct audio_rx_stream
+{
+    lc3_decoder_t         decoder;
+    audio_decoder_mem_t   decoder_mem;
+    uint32_t              freq_hz;
+    uint32_t              frame_duration_us;
+    int                   frame_samples;
+    int                   frames_per_sdu;
+    uint32_t              sdu_interval_us;
+    uint32_t              pd_us;
+    uint32_t              last_ts;
+    struct audio_rx_stats stats;
+    /* Counted on the BT thread, outside decoder_lock */
+    atomic_t              dropped_sdus;
+};
+
+#if defined(CONFIG_AUDIO_RX_CPU_STATS)
+struct cpu_stats
+{
+    uint32_t                 intervals;
+    uint64_t                 burst_cycles;
+    uint32_t                 burst_max_cycles;
+    uint32_t                 plc_frames;
+    uint32_t                 overruns;
+    k_thread_runtime_stats_t last;
+};
+#endif
+
+// --- static functions declarations -------------------------------------------
+static int  sdu_decode(struct net_buf *buf);
+static void audio_rx_thread(void *p1, void *p2, void *p3);
+
+#if defined(CONFIG_AUDIO_RX_LOSS_SIM)
+static bool loss_sim_drop(void);
+#endif
+
+#if defined(CONFIG_AUDIO_RX_CPU_STATS)
+static void cpu_stats_reset(void);
+static void cpu_stats_update(uint32_t burst_cycles);
+#endif
+
+// --- static variables definitions --------------------------------------------
+NET_BUF_POOL_FIXED_DEFINE(sdu_pool,
+                          AUDIO_RX_STREAM_COUNT * CONFIG_AUDIO_RX_SDU_BUF_PER_STREAM,
+                          AUDIO_MAX_SDU_LEN,
+                          sizeof(struct sdu_meta),
+                          NULL);
+
+static K_FIFO_DEFINE(sdu_fifo);
+static K_MUTEX_DEFINE(decoder_lock);
+
+static struct audio_rx_stream rx_streams[AUDIO_RX_STREAM_COUNT];
+static int16_t                pcm_buf[AUDIO_MAX_NUM_SAMPLES];
+static atomic_t               active_streams;
+
+#if defined(CONFIG_AUDIO_RX_CPU_STATS)
+/* Owned by the RX thread, the BT thread only touches the atomics */
+static struct cpu_stats cpu_stats;
+static atomic_t         cpu_stats_dropped_sdus;
+static atomic_t         cpu_stats_restart;
+#endif
+
+#if defined(CONFIG_AUDIO_AEC)
+/* The references are only touched by the RX thread, which clears them */
+static atomic_t aec_ref_stale;
+#endif
+
+#if defined(CONFIG_AUDIO_RX_LOSS_SIM)
+static uint32_t loss_sim_seed = 1U;
+static uint32_t loss_sim_burst_left;
+#endif
+
+K_THREAD_DEFINE(audio_rx_tid,
+                CONFIG_AUDIO_RX_THREAD_STACK_SIZE,
+                audio_rx_thread,
+                NULL,
+                NULL,
+                NULL,
+                CONFIG_AUDIO_RX_THREAD_PRIO,
+                0,
+                0);
+
+// --- static functions definitions --------------------------------------------
+static int
+sdu_decode(struct net_buf *buf)
+{
+    const struct sdu_meta  *meta = net_buf_user_data(buf);
+    struct audio_rx_stream *rx   = &rx_streams[meta->stream_idx];
+    const uint8_t          *in_buf;
+    int                     frames_per_sdu;
+    int                     octets_per_frame;
+    int                     plc_frames = 0;
+    int                     err;
+#if defined(CONFIG_AUDIO_AEC)
+    uint32_t render_ts;
+#endif
+
+    if (rx->decoder == NULL)
+    {
+        /* Stream was stopped while the SDU was queued */
+        return 0;
+    }
+
+#if defined(CONFIG_AUDIO_CODEC_PROFILE_FIXED)
+    /* The layout was checked against the profile in lc3_config(), SDUs of
+     * any other length are treated as lost.
+     */
+    frames_per_sdu   = AUDIO_CODEC_FRAMES_PER_SDU;
+    octets_per_frame = AUDIO_CODEC_OCTETS_PER_FRAME;
+    in_buf = ((meta->flags & BT_ISO_FLAGS_VALID) != 0 && buf->len == AUDIO_CODEC_SDU_LEN) ? buf->data : NULL;
+#else
+    frames_per_sdu   = rx->frames_per_sdu;
+    octets_per_frame = buf->len / rx->frames_per_sdu;
+    in_buf           = ((meta->flags & BT_ISO_FLAGS_VALID) != 0) ? buf->data : NULL;
+#endif
+
+    /* Place the decoded frames on the ISO timeline at the time they are played out */
+    rx->last_ts = ((meta->flags & BT_ISO_FLAGS_TS) != 0) ? meta->ts : (rx->last_ts + rx->sdu_interval_us);
+#if defined(CONFIG_AUDIO_AEC) && defined(CONFIG_AUDIO_LATENCY_CTRL)
+    render_ts = rx->last_ts + audio_latency_ctrl_render_delay_get(meta->stream_idx);
+#elif defined(CONFIG_AUDIO_AEC)
+    render_ts = rx->last_ts + rx->pd_us;
+#endif
+
+    for (int i = 0; i < frames_per_sdu; i++)
+    {
+        err = audio_codec_hal_decode(rx->decoder, in_buf, octets_per_frame, pcm_buf);
+        if (err == 1)
+        {
+            plc_frames++;
+        }
+        else if (err < 0)
+        {
+            LOG_WRN("Decoder failed on stream %u - wrong parameters?", meta->stream_idx);
+            rx->stats.decode_errors++;
+            break;
+        }
+
+#if defined(CONFIG_AUDIO_AEC)
+        /* Far-end reference for the echo canceller of the uplink */
+        audio_aec_ref_put(render_ts, pcm_buf, rx->frame_samples, rx->freq_hz);
+        render_ts += rx->frame_duration_us;
+#endif
+
+        if (in_buf != NULL)
+        {
+            in_buf += octets_per_frame;
+        }
+    }
+
+    rx->stats.decoded_sdus++;
+    rx->stats.plc_frames += plc_frames;
+#if defined(CONFIG_AUDIO_RX_CPU_STATS)
+    cpu_stats.plc_frames += plc_frames;
+#endif
+
+    return plc_frames;
+}
+
+#if defined(CONFIG_AUDIO_RX_CPU_STATS)
+static void
+cpu_stats_reset(void)
+{
+    /* Start a new measurement so that idle time is not averaged into the first report */
+    cpu_stats = (struct cpu_stats) { 0 };
+    atomic_clear(&cpu_stats_dropped_sdus);
+    k_thread_runtime_stats_all_get(&cpu_stats.last);
+}
+
+static void
+cpu_stats_update(uint32_t burst_cycles)
+{
+    k_thread_runtime_stats_t now;
+    uint64_t                 active_cycles;
+    atomic_val_t             dropped_sdus;
+
+    if (k_cyc_to_us_floor32(burst_cycles) > audio_clock_tick_interval_get())
+    {
+        cpu_stats.overruns++;
+    }
+
+    cpu_stats.intervals++;
+    cpu_stats.burst_cycles += burst_cycles;
+    cpu_stats.burst_max_cycles = MAX(cpu_stats.burst_max_cycles, burst_cycles);
+
+    if (cpu_stats.intervals < CONFIG_AUDIO_RX_CPU_STATS_REPORT_INTERVALS)
+    {
+        return;
+    }
+
+    k_thread_runtime_stats_all_get(&now);
+    active_cycles = now.total_cycles - cpu_stats.last.total_cycles;
+    dropped_sdus  = atomic_clear(&cpu_stats_dropped_sdus);
+
+    LOG_INF("CPU active %u us/interval (%u%%), audio avg %u us max %u us, overruns %u, plc %u, dropped %u",
+            (uint32_t)k_cyc_to_us_floor64(active_cycles / cpu_stats.intervals),
+            (uint32_t)((active_cycles * 100U) / MAX(now.execution_cycles - cpu_stats.last.execution_cycles, 1U)),
+            (uint32_t)k_cyc_to_us_floor64(cpu_stats.burst_cycles / cpu_stats.intervals),
+            k_cyc_to_us_floor32(cpu_stats.burst_max_cycles),
+            cpu_stats.overruns,
+            cpu_stats.plc_frames,
+            (uint32_t)dropped_sdus);
+
+    cpu_stats.intervals        = 0U;
+    cpu_stats.burst_cycles     = 0U;
+    cpu_stats.burst_max_cycles = 0U;
+    cpu_stats.overruns         = 0U;
+    cpu_stats.plc_frames       = 0U;
+    cpu_stats.last             = now;
+}
+#endif
+
+#if defined(CONFIG_AUDIO_RX_LOSS_SIM)
+static bool
+loss_sim_drop(void)
+{
+    /* Deterministic LCG so that a given configuration always produces the same loss pattern */
+    loss_sim_seed = (loss_sim_seed * 1103515245U) + 12345U;
+
+    if (loss_sim_burst_left > 0U)
+    {
+        loss_sim_burst_left--;
+        return true;
+    }
+
+    if (((loss_sim_seed >> 16) % 1000U) < CONFIG_AUDIO_RX_LOSS_SIM_PERMILL)
+    {
+        loss_sim_burst_left = CONFIG_AUDIO_RX_LOSS_SIM_BURST_LEN - 1U;
+        return true;
+    }
+
+    return false;
+}
+#endif
+
+static void
+audio_rx_thread(void *p1, void *p2, void *p3)
+{
+    struct net_buf *buf;
+    uint32_t        start;
+    uint32_t        now_us;
+    uint32_t        decoded;
+
+    for (;;)
+    {
+        /* Sleep until the next SDU interval, everything received in between
+         * is decoded in a single burst followed by the uplink, so that the
+         * whole round trip is measured against one SDU interval.
+         */
+        audio_clock_tick_wait();
+
+#if defined(CONFIG_AUDIO_AEC)
+        if (atomic_clear(&aec_ref_stale) != 0)
+        {
+            audio_aec_ref_reset();
+        }
+#endif
+
+#if defined(CONFIG_AUDIO_RX_CPU_STATS)
+        if (atomic_clear(&cpu_stats_restart) != 0)
+        {
+            cpu_stats_reset();
+        }
+#endif
+
+        start   = k_cycle_get_32();
+        now_us  = audio_clock_now();
+        decoded = 0U;
+
+        k_mutex_lock(&decoder_lock, K_FOREVER);
+        while ((buf = k_fifo_get(&sdu_fifo, K_NO_WAIT)) != NULL)
+        {
+            const struct sdu_meta *meta       = net_buf_user_data(buf);
+            const int              plc_frames = sdu_decode(buf);
+
+            audio_latency_ctrl_sdu(meta->stream_idx, meta->flags, meta->seq_num, meta->ts, plc_frames, now_us);
+            decoded |= BIT(meta->stream_idx);
+            net_buf_unref(buf);
+        }
+
+        /* Charge a late burst to every stream it carried */
+        if (k_cyc_to_us_floor32(k_cycle_get_32() - start) > audio_clock_tick_interval_get())
+        {
+            for (uint8_t i = 0U; i < ARRAY_SIZE(rx_streams); i++)
+            {
+                if ((decoded & BIT(i)) != 0)
+                {
+                    rx_streams[i].stats.overruns++;
+                }
+            }
+        }
+        k_mutex_unlock(&decoder_lock);
+
+        audio_tx_process();
+
+#if defined(CONFIG_AUDIO_RX_CPU_STATS)
+        cpu_stats_update(k_cycle_get_32() - start);
+#else
+        ARG_UNUSED(start);
+#endif
+    }
+}
+
+// --- functions definitions ---------------------------------------------------
+int
+audio_rx_stream_setup(uint8_t stream_idx, int freq_hz, int frame_duration_us, int frames_per_sdu)
+{
+    struct audio_rx_stream *rx;
+
+    __ASSERT(stream_idx < ARRAY_SIZE(rx_streams), "Invalid stream index %u", stream_idx);
+    rx = &rx_streams[stream_idx];
+
+    if (frames_per_sdu <= 0)
+    {
+        LOG_ERR("Invalid frame blocks per SDU %d", frames_per_sdu);
+        return -EINVAL;
+    }
+
+    k_mutex_lock(&decoder_lock, K_FOREVER);
+    rx->decoder           = audio_codec_hal_decoder_setup(frame_duration_us, freq_hz, &rx->decoder_mem);
+    rx->freq_hz           = freq_hz;
+    rx->frame_duration_us = frame_duration_us;
+    rx->frame_samples     = audio_codec_hal_frame_samples(frame_duration_us, freq_hz);
+    rx->frames_per_sdu    = frames_per_sdu;
+    rx->sdu_interval_us   = frame_duration_us * frames_per_sdu;
+    k_mutex_unlock(&decoder_lock);
+
+    if (rx->decoder == NULL)
+    {
+        LOG_ERR("Failed to setup LC3 decoder - wrong parameters?");
+        return -EINVAL;
+    }
+
+    return 0;
+}
+
+void
+audio_rx_stream_start(uint8_t stream_idx, uint32_t pd_us)
+{
+    atomic_val_t prev;
+
+    __ASSERT(stream_idx < ARRAY_SIZE(rx_streams), "Invalid stream index %u", stream_idx);
+
+    prev = atomic_or(&active_streams, BIT(stream_idx));
+    if ((prev & BIT(stream_idx)) != 0)
+    {
+        return;
+    }
+
+#if defined(CONFIG_AUDIO_RX_CPU_STATS)
+    if (prev == 0)
+    {
+        /* Reset by the RX thread, which owns the measurement */
+        atomic_set(&cpu_stats_restart, 1);
+    }
+#endif
+
+    k_mutex_lock(&decoder_lock, K_FOREVER);
+    rx_streams[stream_idx].pd_us = pd_us;
+    rx_streams[stream_idx].stats = (struct audio_rx_stats) { 0 };
+    atomic_clear(&rx_streams[stream_idx].dropped_sdus);
+    k_mutex_unlock(&decoder_lock);
+
+    audio_clock_tick_start(rx_streams[stream_idx].sdu_interval_us);
+}
+
+void
+audio_rx_stream_stop(uint8_t stream_idx)
+{
+    struct net_buf *buf;
+
+    __ASSERT(stream_idx < ARRAY_SIZE(rx_streams), "Invalid stream index %u", stream_idx);
+
+    if (!atomic_test_and_clear_bit(&active_streams, stream_idx))
+    {
+        return;
+    }
+
+    k_mutex_lock(&decoder_lock, K_FOREVER);
+    /* Nothing to free as static memory is used */
+    rx_streams[stream_idx].decoder = NULL;
+
+    if (atomic_get(&active_streams) == 0)
+    {
+        /* Nothing left to decode, release every queued SDU */
+        while ((buf = k_fifo_get(&sdu_fifo, K_NO_WAIT)) != NULL)
+        {
+            net_buf_unref(buf);
+        }
+
+#if defined(CONFIG_AUDIO_AEC)
+        /* Read by the uplink outside decoder_lock, so clear them before the next burst instead */
+        atomic_set(&aec_ref_stale, 1);
+#endif
+    }
+    k_mutex_unlock(&decoder_lock);
+
+    /* The core idles once no stream needs the pipeline anymore */
+    audio_clock_tick_stop();
+}
+
+void
+audio_rx_sdu_put(uint8_t stream_idx, const struct bt_iso_recv_info *info, const struct net_buf *buf)
+{
+    struct net_buf  *sdu;
+    struct sdu_meta *meta;
+
+    if (!atomic_test_bit(&active_streams, stream_idx))
+    {
+        return;
+    }
+
+    sdu = net_buf_alloc(&sdu_pool, K_NO_WAIT);
+    if (sdu == NULL)
+    {
+        atomic_inc(&rx_streams[stream_idx].dropped_sdus);
+#if defined(CONFIG_AUDIO_RX_CPU_STATS)
+        atomic_inc(&cpu_stats_dropped_sdus);
+#endif
+        LOG_DBG("SDU pool empty, dropping SDU on stream %u", stream_idx);
+        return;
+    }
+
+    meta             = net_buf_user_data(sdu);
+    meta->stream_idx = stream_idx;
+    meta->flags      = info->flags;
+    meta->seq_num    = info->seq_num;
+    meta->ts         = info->ts;
+
+    if ((info->flags & BT_ISO_FLAGS_TS) != 0)
+    {
+        audio_clock_sync(info->ts);
+    }
+
+#if defined(CONFIG_AUDIO_RX_LOSS_SIM)
+    if (loss_sim_drop())
+    {
+        meta->flags &= ~BT_ISO_FLAGS_VALID;
+    }
+#endif
+
+    if ((info->flags & BT_ISO_FLAGS_VALID) != 0)
+    {
+        if (buf->len > net_buf_tailroom(sdu))
+        {
+            LOG_WRN("SDU of %u octets exceeds the maximum of %u", buf->len, AUDIO_MAX_SDU_LEN);
+            meta->flags &= ~BT_ISO_FLAGS_VALID;
+        }
+        else
+        {
+            net_buf_add_mem(sdu, buf->data, buf->len);
+        }
+    }
+
+    k_fifo_put(&sdu_fifo, sdu);
+}
+
+void
+audio_rx_stats_get(uint8_t stream_idx, struct audio_rx_stats *stats)
+{
+    __ASSERT(stream_idx < ARRAY_SIZE(rx_streams), "Invalid stream index %u", stream_idx);
+
+    k_mutex_lock(&decoder_lock, K_FOREVER);
+    *stats              = rx_streams[stream_idx].stats;
+    stats->dropped_sdus = (uint32_t)atomic_get(&rx_streams[stream_idx].dropped_sdus);
+    k_mutex_unlock(&decoder_lock);
+}
@@ -0,0 +1,35 @@
+#ifndef AUDIO_RX_H
+#define AUDIO_RX_H
+
+// --- includes ----------------------------------------------------------------
+#include "audio_codec_profile.h"
+
+#include <stdint.h>
+#include <zephyr/bluetooth/iso.h>
+#include <zephyr/net/buf.h>
+
+// --- defines -----------------------------------------------------------------
+#define AUDIO_RX_STREAM_COUNT CONFIG_BT_ASCS_MAX_ASE_SNK_COUNT
+
+// --- structs -----------------------------------------------------------------
+/* Counted from the last audio_rx_stream_start() of the stream */
+struct audio_rx_stats
+{
+    uint32_t decoded_sdus;
+    uint32_t plc_frames;
+    /* Frames the decoder rejected, a wrong codec configuration */
+    uint32_t decode_errors;
+    /* SDUs lost because the SDU pool was empty */
+    uint32_t dropped_sdus;
+    /* SDU intervals in which decoding the stream finished too late */
+    uint32_t overruns;
+};
+
+// --- functions declarations --------------------------------------------------
+int  audio_rx_stream_setup(uint8_t stream_idx, int freq_hz, int frame_duration_us, int frames_per_sdu);
+void audio_rx_stream_start(uint8_t stream_idx, uint32_t pd_us);
+void audio_rx_stream_stop(uint8_t stream_idx);
+void audio_rx_sdu_put(uint8_t stream_idx, const struct bt_iso_recv_info *info, const struct net_buf *buf);
+void audio_rx_stats_get(uint8_t stream_idx, struct audio_rx_stats *stats);
+
+#endif // AUDIO_RX_H
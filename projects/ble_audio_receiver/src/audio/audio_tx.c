@@ -0,0 +1,227 @@
+// --- includes ----------------------------------------------------------------
+#include "audio_tx.h"
+
+#include "audio_aec.h"
+#include "audio_clock.h"
+#include "audio_codec_hal.h"
+#include "audio_rx.h"
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+
+// --- logging settings --------------------------------------------------------
+LOG_MODULE_DECLARE(audio_m);
+
+// --- structs -----------------------------------------------------------------
+struct audio_tx_stream
+{
+    audio_tx_send_t       send;
+    lc3_encoder_t         encoder;
+    audio_encoder_mem_t   encoder_mem;
+    uint32_t              freq_hz;
+    uint32_t              frame_duration_us;
+    int                   frame_samples;
+    int                   octets_per_frame;
+    int                   frames_per_sdu;
+    uint16_t              seq_num;
+    struct audio_tx_stats stats;
+};
+
+// --- static functions declarations -------------------------------------------
+static void stream_encode_and_send(uint8_t stream_idx);
+
+// --- static variables definitions --------------------------------------------
+/* CONFIG_BT_ISO_TX_BUF_COUNT is already scaled by the source ASE count */
+NET_BUF_POOL_FIXED_DEFINE(tx_pool,
+                          CONFIG_BT_ISO_TX_BUF_COUNT,
+#if defined(CONFIG_AUDIO_CODEC_PROFILE_FIXED)
+                          BT_ISO_SDU_BUF_SIZE(AUDIO_CODEC_SDU_LEN),
+#else
+                          BT_ISO_SDU_BUF_SIZE(CONFIG_BT_ISO_TX_MTU),
+#endif
+                          CONFIG_BT_CONN_TX_USER_DATA_SIZE,
+                          NULL);
+
+static K_MUTEX_DEFINE(encoder_lock);
+
+static struct audio_tx_stream tx_streams[AUDIO_TX_STREAM_COUNT];
+static atomic_t               active_streams;
+static int16_t                mic_buf[AUDIO_MAX_NUM_SAMPLES];
+#if defined(CONFIG_AUDIO_AEC)
+static int16_t ref_buf[AUDIO_MAX_NUM_SAMPLES];
+static int16_t pcm_buf[AUDIO_MAX_NUM_SAMPLES];
+#endif
+
+// --- static functions definitions --------------------------------------------
+static void
+stream_encode_and_send(uint8_t stream_idx)
+{
+    struct audio_tx_stream *tx = &tx_streams[stream_idx];
+    struct net_buf         *buf;
+    int                     err;
+#if defined(CONFIG_AUDIO_AEC)
+    uint32_t capture_ts;
+#endif
+
+    buf = net_buf_alloc(&tx_pool, K_NO_WAIT);
+    if (buf == NULL)
+    {
+        /* Previous SDUs are still in flight, skip this interval */
+        LOG_DBG("No TX buffer for stream %u", stream_idx);
+        tx->stats.skipped_sdus++;
+        return;
+    }
+
+    net_buf_reserve(buf, BT_ISO_CHAN_SEND_RESERVE);
+
+#if defined(CONFIG_AUDIO_AEC)
+    /* The SDU carries the audio captured during the last SDU interval */
+    capture_ts = audio_clock_now() - (tx->frames_per_sdu * tx->frame_duration_us);
+#endif
+
+    for (int i = 0; i < tx->frames_per_sdu; i++)
+    {
+        const int16_t *pcm = mic_buf;
+
+        audio_tx_capture(stream_idx, mic_buf, tx->frame_samples);
+
+#if defined(CONFIG_AUDIO_AEC)
+        if (audio_clock_is_synced()
+            && audio_aec_ref_get(capture_ts + (i * tx->frame_duration_us), ref_buf, tx->frame_samples, tx->freq_hz)
+                   == 0)
+        {
+            audio_aec_process(stream_idx, mic_buf, ref_buf, pcm_buf, tx->frame_samples);
+            pcm = pcm_buf;
+        }
+#endif
+
+        err = audio_codec_hal_encode(tx->encoder, pcm, tx->octets_per_frame, net_buf_add(buf, tx->octets_per_frame));
+        if (err < 0)
+        {
+            LOG_WRN("Encoder failed on stream %u - wrong parameters?", stream_idx);
+            net_buf_unref(buf);
+            tx->stats.skipped_sdus++;
+            return;
+        }
+    }
+
+    err = tx->send(stream_idx, buf, tx->seq_num++);
+    if (err < 0)
+    {
+        LOG_DBG("Failed to send SDU on stream %u: %d", stream_idx, err);
+        net_buf_unref(buf);
+        tx->stats.skipped_sdus++;
+        return;
+    }
+
+    tx->stats.sent_sdus++;
+}
+
+// --- functions definitions ---------------------------------------------------
+__weak int
+audio_tx_capture(uint8_t stream_idx, int16_t *pcm, size_t samples)
+{
+    /* No microphone wired in, send silence */
+    memset(pcm, 0, samples * sizeof(pcm[0]));
+    return 0;
+}
+
+int
+audio_tx_stream_setup(uint8_t         stream_idx,
+                      audio_tx_send_t send,
+                      int             freq_hz,
+                      int             frame_duration_us,
+                      int             octets_per_frame,
+                      int             frames_per_sdu)
+{
+    struct audio_tx_stream *tx;
+
+    __ASSERT(stream_idx < ARRAY_SIZE(tx_streams), "Invalid stream index %u", stream_idx);
+    tx = &tx_streams[stream_idx];
+
+    if (frames_per_sdu <= 0 || octets_per_frame <= 0
+        || (octets_per_frame * frames_per_sdu) > CONFIG_BT_ISO_TX_MTU)
+    {
+        LOG_ERR("Invalid SDU layout: %d frames of %d octets", frames_per_sdu, octets_per_frame);
+        return -EINVAL;
+    }
+
+    k_mutex_lock(&encoder_lock, K_FOREVER);
+    tx->send              = send;
+    tx->encoder           = audio_codec_hal_encoder_setup(frame_duration_us, freq_hz, &tx->encoder_mem);
+    tx->freq_hz           = freq_hz;
+    tx->frame_duration_us = frame_duration_us;
+    tx->frame_samples     = audio_codec_hal_frame_samples(frame_duration_us, freq_hz);
+    tx->octets_per_frame  = octets_per_frame;
+    tx->frames_per_sdu    = frames_per_sdu;
+    k_mutex_unlock(&encoder_lock);
+
+    if (tx->encoder == NULL)
+    {
+        LOG_ERR("Failed to setup LC3 encoder - wrong parameters?");
+        return -EINVAL;
+    }
+
+    return 0;
+}
+
+void
+audio_tx_stream_start(uint8_t stream_idx)
+{
+    __ASSERT(stream_idx < ARRAY_SIZE(tx_streams), "Invalid stream index %u", stream_idx);
+
+    if (atomic_test_and_set_bit(&active_streams, stream_idx))
+    {
+        return;
+    }
+
+    k_mutex_lock(&encoder_lock, K_FOREVER);
+    tx_streams[stream_idx].seq_num = 0U;
+    tx_streams[stream_idx].stats   = (struct audio_tx_stats) { 0 };
+    k_mutex_unlock(&encoder_lock);
+
+    audio_clock_tick_start(tx_streams[stream_idx].frames_per_sdu * tx_streams[stream_idx].frame_duration_us);
+}
+
+void
+audio_tx_stream_stop(uint8_t stream_idx)
+{
+    __ASSERT(stream_idx < ARRAY_SIZE(tx_streams), "Invalid stream index %u", stream_idx);
+
+    if (!atomic_test_and_clear_bit(&active_streams, stream_idx))
+    {
+        return;
+    }
+
+    k_mutex_lock(&encoder_lock, K_FOREVER);
+    /* Nothing to free as static memory is used */
+    tx_streams[stream_idx].encoder = NULL;
+    k_mutex_unlock(&encoder_lock);
+
+    audio_clock_tick_stop();
+}
+
+void
+audio_tx_process(void)
+{
+    k_mutex_lock(&encoder_lock, K_FOREVER);
+    for (uint8_t i = 0U; i < ARRAY_SIZE(tx_streams); i++)
+    {
+        if (atomic_test_bit(&active_streams, i) && tx_streams[i].encoder != NULL)
+        {
+            stream_encode_and_send(i);
+        }
+    }
+    k_mutex_unlock(&encoder_lock);
+}
+
+void
+audio_tx_stats_get(uint8_t stream_idx, struct audio_tx_stats *stats)
+{
+    __ASSERT(stream_idx < ARRAY_SIZE(tx_streams), "Invalid stream index %u", stream_idx);
+
+    k_mutex_lock(&encoder_lock, K_FOREVER);
+    *stats = tx_streams[stream_idx].stats;
+    k_mutex_unlock(&encoder_lock);
+}
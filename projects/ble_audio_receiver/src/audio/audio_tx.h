@@ -0,0 +1,38 @@
+#ifndef AUDIO_TX_H
+#define AUDIO_TX_H
+
+// --- includes ----------------------------------------------------------------
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/net/buf.h>
+
+// --- defines -----------------------------------------------------------------
+#define AUDIO_TX_STREAM_COUNT CONFIG_BT_ASCS_MAX_ASE_SRC_COUNT
+
+// --- structs -----------------------------------------------------------------
+/* Counted from the last audio_tx_stream_start() of the stream */
+struct audio_tx_stats
+{
+    uint32_t sent_sdus;
+    /* SDU intervals without an SDU, for lack of a TX buffer or a failed send */
+    uint32_t skipped_sdus;
+};
+
+// --- typedefs ----------------------------------------------------------------
+/* Hands an encoded SDU to the transport, which owns buf once this returns 0 */
+typedef int (*audio_tx_send_t)(uint8_t stream_idx, struct net_buf *buf, uint16_t seq_num);
+
+// --- functions declarations --------------------------------------------------
+int  audio_tx_stream_setup(uint8_t         stream_idx,
+                           audio_tx_send_t send,
+                           int             freq_hz,
+                           int             frame_duration_us,
+                           int             octets_per_frame,
+                           int             frames_per_sdu);
+void audio_tx_stream_start(uint8_t stream_idx);
+void audio_tx_stream_stop(uint8_t stream_idx);
+void audio_tx_process(void);
+int  audio_tx_capture(uint8_t stream_idx, int16_t *pcm, size_t samples);
+void audio_tx_stats_get(uint8_t stream_idx, struct audio_tx_stats *stats);
+
+#endif // AUDIO_TX_H
@@ -0,0 +1,91 @@
+// --- includes ----------------------------------------------------------------
+#include "ble_audio_hal.h"
+
+// --- functions definitions ---------------------------------------------------
+int
+ble_audio_hal_server_register(const struct bt_bap_unicast_server_register_param *param)
+{
+    return bt_bap_unicast_server_register(param);
+}
+
+int
+ble_audio_hal_server_register_cb(const struct bt_bap_unicast_server_cb *cb)
+{
+    return bt_bap_unicast_server_register_cb(cb);
+}
+
+int
+ble_audio_hal_pacs_cap_register(enum bt_audio_dir dir, struct bt_pacs_cap *cap)
+{
+    return bt_pacs_cap_register(dir, cap);
+}
+
+int
+ble_audio_hal_pacs_set_location(enum bt_audio_dir dir, enum bt_audio_location location)
+{
+    return bt_pacs_set_location(dir, location);
+}
+
+int
+ble_audio_hal_pacs_set_supported_contexts(enum bt_audio_dir dir, enum bt_audio_context contexts)
+{
+    return bt_pacs_set_supported_contexts(dir, contexts);
+}
+
+int
+ble_audio_hal_pacs_set_available_contexts(enum bt_audio_dir dir, enum bt_audio_context contexts)
+{
+    return bt_pacs_set_available_contexts(dir, contexts);
+}
+
+void
+ble_audio_hal_stream_cb_register(struct bt_bap_stream *stream, struct bt_bap_stream_ops *ops)
+{
+    bt_bap_stream_cb_register(stream, ops);
+}
+
+int
+ble_audio_hal_stream_start(struct bt_bap_stream *stream)
+{
+    return bt_bap_stream_start(stream);
+}
+
+int
+ble_audio_hal_stream_send(struct bt_bap_stream *stream, struct net_buf *buf, uint16_t seq_num)
+{
+    return bt_bap_stream_send(stream, buf, seq_num);
+}
+
+int
+ble_audio_hal_codec_cfg_get_freq_hz(const struct bt_audio_codec_cfg *codec_cfg)
+{
+    const int ret = bt_audio_codec_cfg_get_freq(codec_cfg);
+
+    return (ret > 0) ? bt_audio_codec_cfg_freq_to_freq_hz(ret) : ret;
+}
+
+int
+ble_audio_hal_codec_cfg_get_frame_dur_us(const struct bt_audio_codec_cfg *codec_cfg)
+{
+    const int ret = bt_audio_codec_cfg_get_frame_dur(codec_cfg);
+
+    return (ret > 0) ? bt_audio_codec_cfg_frame_dur_to_frame_dur_us(ret) : ret;
+}
+
+int
+ble_audio_hal_codec_cfg_get_octets_per_frame(const struct bt_audio_codec_cfg *codec_cfg)
+{
+    return bt_audio_codec_cfg_get_octets_per_frame(codec_cfg);
+}
+
+int
+ble_audio_hal_codec_cfg_get_frame_blocks_per_sdu(const struct bt_audio_codec_cfg *codec_cfg)
+{
+    return bt_audio_codec_cfg_get_frame_blocks_per_sdu(codec_cfg, true);
+}
+
+const bt_addr_le_t *
+ble_audio_hal_conn_get_dst(const struct bt_conn *conn)
+{
+    return bt_conn_get_dst(conn);
+}
@@ -0,0 +1,33 @@
+#ifndef BLE_AUDIO_HAL_H
+#define BLE_AUDIO_HAL_H
+
+// --- includes ----------------------------------------------------------------
+#include <stdint.h>
+#include <zephyr/bluetooth/audio/audio.h>
+#include <zephyr/bluetooth/audio/bap.h>
+#include <zephyr/bluetooth/audio/pacs.h>
+#include <zephyr/bluetooth/conn.h>
+#include <zephyr/net/buf.h>
+
+// --- functions declarations --------------------------------------------------
+/* Thin adapter over the Zephyr BAP/PACS APIs used by the unicast server.
+ * Host builds link fakes of these functions instead of the BT stack.
+ */
+int  ble_audio_hal_server_register(const struct bt_bap_unicast_server_register_param *param);
+int  ble_audio_hal_server_register_cb(const struct bt_bap_unicast_server_cb *cb);
+int  ble_audio_hal_pacs_cap_register(enum bt_audio_dir dir, struct bt_pacs_cap *cap);
+int  ble_audio_hal_pacs_set_location(enum bt_audio_dir dir, enum bt_audio_location location);
+int  ble_audio_hal_pacs_set_supported_contexts(enum bt_audio_dir dir, enum bt_audio_context contexts);
+int  ble_audio_hal_pacs_set_available_contexts(enum bt_audio_dir dir, enum bt_audio_context contexts);
+void ble_audio_hal_stream_cb_register(struct bt_bap_stream *stream, struct bt_bap_stream_ops *ops);
+int  ble_audio_hal_stream_start(struct bt_bap_stream *stream);
+int  ble_audio_hal_stream_send(struct bt_bap_stream *stream, struct net_buf *buf, uint16_t seq_num);
+
+int ble_audio_hal_codec_cfg_get_freq_hz(const struct bt_audio_codec_cfg *codec_cfg);
+int ble_audio_hal_codec_cfg_get_frame_dur_us(const struct bt_audio_codec_cfg *codec_cfg);
+int ble_audio_hal_codec_cfg_get_octets_per_frame(const struct bt_audio_codec_cfg *codec_cfg);
+int ble_audio_hal_codec_cfg_get_frame_blocks_per_sdu(const struct bt_audio_codec_cfg *codec_cfg);
+
+const bt_addr_le_t *ble_audio_hal_conn_get_dst(const struct bt_conn *conn);
+
+#endif // BLE_AUDIO_HAL_H
@@ -1,8 +1,18 @@
 // --- includes ----------------------------------------------------------------
 #include "ble_bap_unicast_server.h"
 
+#include "ble_audio_hal.h"
+
+#if defined(CONFIG_LIBLC3)
+#include "audio/audio_codec_profile.h"
+#include "audio/audio_latency_ctrl.h"
+#include "audio/audio_rx.h"
+#include "audio/audio_tx.h"
+#endif
+
 #include <zephyr/bluetooth/audio/bap.h>
 #include <zephyr/bluetooth/audio/pacs.h>
+#include <zephyr/sys/slist.h>
 
 #include <zephyr/logging/log.h>
 
@@ -10,26 +20,67 @@
 LOG_MODULE_DECLARE(ble_m);
 
 // --- defines -----------------------------------------------------------------
+#if defined(CONFIG_AUDIO_CODEC_PROFILE_FIXED)
+/* Only advertise the configuration the fixed profile was built for */
+#define LC3_CAP_FREQ           AUDIO_CODEC_CAP_FREQ
+#define LC3_CAP_DURATION       AUDIO_CODEC_CAP_DURATION
+#define LC3_CAP_OCTETS_MIN     AUDIO_CODEC_OCTETS_PER_FRAME
+#define LC3_CAP_OCTETS_MAX     AUDIO_CODEC_OCTETS_PER_FRAME
+#define LC3_CAP_FRAMES_PER_SDU AUDIO_CODEC_FRAMES_PER_SDU
+#else
+#define LC3_CAP_FREQ           BT_AUDIO_CODEC_CAP_FREQ_ANY
+#define LC3_CAP_DURATION       BT_AUDIO_CODEC_CAP_DURATION_10
+#define LC3_CAP_OCTETS_MIN     40u
+#define LC3_CAP_OCTETS_MAX     120u
+#define LC3_CAP_FRAMES_PER_SDU 1u
+#endif
+
 static const struct bt_audio_codec_cap lc3_codec_cap
-    = BT_AUDIO_CODEC_CAP_LC3(BT_AUDIO_CODEC_CAP_FREQ_ANY,
-                             BT_AUDIO_CODEC_CAP_DURATION_10,
+    = BT_AUDIO_CODEC_CAP_LC3(LC3_CAP_FREQ,
+                             LC3_CAP_DURATION,
                              BT_AUDIO_CODEC_CAP_CHAN_COUNT_SUPPORT(1),
-                             40u,
-                             120u,
-                             1u,
+                             LC3_CAP_OCTETS_MIN,
+                             LC3_CAP_OCTETS_MAX,
+                             LC3_CAP_FRAMES_PER_SDU,
                              (BT_AUDIO_CONTEXT_TYPE_CONVERSATIONAL | BT_AUDIO_CONTEXT_TYPE_MEDIA));
-#define AUDIO_DATA_TIMEOUT_US 1000000UL /* Send data every 1 second */
-#define SDU_INTERVAL_US       10000UL   /* 10 ms SDU interval */
-static const struct bt_audio_codec_qos_pref qos_pref
-    = BT_AUDIO_CODEC_QOS_PREF(true, BT_GAP_LE_PHY_2M, 0x02, 10, 40000, 40000, 40000, 40000);
-NET_BUF_POOL_FIXED_DEFINE(tx_pool,
-                          CONFIG_BT_ASCS_MAX_ASE_SRC_COUNT,
-                          BT_ISO_SDU_BUF_SIZE(CONFIG_BT_ISO_TX_MTU),
-                          CONFIG_BT_CONN_TX_USER_DATA_SIZE,
-                          NULL);
+static const struct bt_audio_codec_qos_pref qos_pref = BT_AUDIO_CODEC_QOS_PREF(true,
+                                                                              BT_GAP_LE_PHY_2M,
+                                                                              CONFIG_BLE_BAP_RTN,
+                                                                              10,
+                                                                              CONFIG_BLE_BAP_PD_MIN_US,
+                                                                              CONFIG_BLE_BAP_PD_MAX_US,
+                                                                              CONFIG_BLE_BAP_PD_MAX_US,
+                                                                              CONFIG_BLE_BAP_PD_MAX_US);
+
+// --- structs -----------------------------------------------------------------
+struct lc3_params
+{
+    int freq_hz;
+    int frame_duration_us;
+    int octets_per_frame;
+    int frames_per_sdu;
+};
+
+/* Per-ASE state, recovered from the embedded stream with CONTAINER_OF */
+struct ase_ctx
+{
+    struct bt_bap_stream stream;
+    sys_snode_t          node;
+    enum bt_audio_dir    dir;
+    uint8_t              idx; /* Index within its direction, shared with audio_rx/audio_tx */
+    bool                 started;
+    uint16_t             max_sdu;
+};
 
 // --- static functions declarations -------------------------------------------
-static struct bt_bap_stream *stream_alloc(enum bt_audio_dir dir);
+static struct ase_ctx *ase_get(struct bt_bap_stream *stream);
+static struct ase_ctx *ase_alloc(enum bt_audio_dir dir);
+static void            ase_free(struct ase_ctx *ase);
+static void            ase_stop(struct ase_ctx *ase);
+#if defined(CONFIG_LIBLC3)
+static int codec_cfg_parse(const struct bt_audio_codec_cfg *codec_cfg, struct lc3_params *params);
+static int source_sdu_send(uint8_t stream_idx, struct net_buf *buf, uint16_t seq_num);
+#endif
 
 static int lc3_config(struct bt_conn                        *conn,
                       const struct bt_bap_ep                *ep,
@@ -54,8 +105,6 @@ static int lc3_disable(struct bt_bap_stream *stream, struct bt_bap_ascs_rsp *rsp
 static int lc3_stop(struct bt_bap_stream *stream, struct bt_bap_ascs_rsp *rsp);
 static int lc3_release(struct bt_bap_stream *stream, struct bt_bap_ascs_rsp *rsp);
 
-static enum bt_audio_dir stream_dir(const struct bt_bap_stream *stream);
-
 #if defined(CONFIG_LIBLC3)
 static void stream_recv_lc3_codec(struct bt_bap_stream          *stream,
                                   const struct bt_iso_recv_info *info,
@@ -66,22 +115,19 @@ static void stream_recv(struct bt_bap_stream *stream, const struct bt_iso_recv_i
 static void stream_stopped(struct bt_bap_stream *stream, uint8_t reason);
 static void stream_started(struct bt_bap_stream *stream);
 static void stream_enabled_cb(struct bt_bap_stream *stream);
+static void stream_released(struct bt_bap_stream *stream);
 
 static int set_location(void);
 static int set_supported_contexts(void);
 static int set_available_contexts(void);
 
 // --- static variables definitions --------------------------------------------
-static size_t                  configured_source_stream_count;
-static struct k_work_delayable audio_send_work;
-static struct bt_bap_stream    sink_streams[CONFIG_BT_ASCS_MAX_ASE_SNK_COUNT];
-static struct audio_source
-{
-    struct bt_bap_stream stream;
-    uint16_t             seq_num;
-    uint16_t             max_sdu;
-    size_t               len_to_send;
-} source_streams[CONFIG_BT_ASCS_MAX_ASE_SRC_COUNT];
+static struct ase_ctx sink_ases[CONFIG_BT_ASCS_MAX_ASE_SNK_COUNT];
+static struct ase_ctx source_ases[CONFIG_BT_ASCS_MAX_ASE_SRC_COUNT];
+static sys_slist_t    free_sink_ases;
+static sys_slist_t    free_source_ases;
+static size_t         configured_ase_count[2]; /* Indexed by direction - 1 */
+static size_t         started_ase_count;
 
 static struct bt_bap_unicast_server_register_param param
     = { CONFIG_BT_ASCS_MAX_ASE_SNK_COUNT, CONFIG_BT_ASCS_MAX_ASE_SRC_COUNT };
@@ -93,61 +139,115 @@ static struct bt_pacs_cap cap_sink = {
 static struct bt_pacs_cap cap_source = {
     .codec_cap = &lc3_codec_cap,
 };
-#if defined(CONFIG_LIBLC3)
-
-#include "lc3.h"
-
-#define MAX_SAMPLE_RATE       48000
-#define MAX_FRAME_DURATION_US 10000
-#define MAX_NUM_SAMPLES       ((MAX_FRAME_DURATION_US * MAX_SAMPLE_RATE) / USEC_PER_SEC)
-static int16_t               audio_buf[MAX_NUM_SAMPLES];
-static lc3_decoder_t         lc3_decoder;
-static lc3_decoder_mem_48k_t lc3_decoder_mem;
-static int                   frames_per_sdu;
-
-#endif
 static struct bt_bap_stream_ops stream_ops = {
 #if defined(CONFIG_LIBLC3)
     .recv = stream_recv_lc3_codec,
 #else
     .recv = stream_recv,
 #endif
-    .stopped = stream_stopped,
-    .started = stream_started,
-    .enabled = stream_enabled_cb,
+    .stopped  = stream_stopped,
+    .started  = stream_started,
+    .enabled  = stream_enabled_cb,
+    .released = stream_released,
 };
 
 // --- static functions definitions --------------------------------------------
-static struct bt_bap_stream *
-stream_alloc(enum bt_audio_dir dir)
+static struct ase_ctx *
+ase_get(struct bt_bap_stream *stream)
+{
+    return CONTAINER_OF(stream, struct ase_ctx, stream);
+}
+
+static struct ase_ctx *
+ase_alloc(enum bt_audio_dir dir)
 {
-    if (dir == BT_AUDIO_DIR_SOURCE)
+    sys_slist_t *free_list = (dir == BT_AUDIO_DIR_SOURCE) ? &free_source_ases : &free_sink_ases;
+    sys_snode_t *node      = sys_slist_get(free_list);
+
+    if (node == NULL)
     {
-        for (size_t i = 0; i < ARRAY_SIZE(source_streams); i++)
-        {
-            struct bt_bap_stream *stream = &source_streams[i].stream;
+        return NULL;
+    }
 
-            if (!stream->conn)
-            {
-                return stream;
-            }
-        }
+    configured_ase_count[dir - 1]++;
+    return CONTAINER_OF(node, struct ase_ctx, node);
+}
+
+static void
+ase_free(struct ase_ctx *ase)
+{
+    __ASSERT(configured_ase_count[ase->dir - 1] > 0, "ASE accounting underflow");
+
+    configured_ase_count[ase->dir - 1]--;
+    ase->max_sdu = 0U;
+    sys_slist_append((ase->dir == BT_AUDIO_DIR_SOURCE) ? &free_source_ases : &free_sink_ases, &ase->node);
+}
+
+static void
+ase_stop(struct ase_ctx *ase)
+{
+    if (!ase->started)
+    {
+        return;
+    }
+
+    ase->started = false;
+    started_ase_count--;
+
+#if defined(CONFIG_LIBLC3)
+    if (ase->dir == BT_AUDIO_DIR_SINK)
+    {
+        audio_rx_stream_stop(ase->idx);
+        audio_latency_ctrl_stream_stop(ase->idx);
     }
     else
     {
-        for (size_t i = 0; i < ARRAY_SIZE(sink_streams); i++)
-        {
-            struct bt_bap_stream *stream = &sink_streams[i];
+        audio_tx_stream_stop(ase->idx);
+    }
+#endif
+}
 
-            if (!stream->conn)
-            {
-                return stream;
-            }
-        }
+#if defined(CONFIG_LIBLC3)
+static int
+codec_cfg_parse(const struct bt_audio_codec_cfg *codec_cfg, struct lc3_params *params)
+{
+    int ret;
+
+    ret = ble_audio_hal_codec_cfg_get_freq_hz(codec_cfg);
+    if (ret <= 0)
+    {
+        LOG_ERR("Error: Codec frequency not set, cannot start codec.");
+        return (ret < 0) ? ret : -EINVAL;
     }
+    params->freq_hz = ret;
 
-    return NULL;
+    ret = ble_audio_hal_codec_cfg_get_frame_dur_us(codec_cfg);
+    if (ret <= 0)
+    {
+        LOG_ERR("Error: Frame duration not set, cannot start codec.");
+        return (ret < 0) ? ret : -EINVAL;
+    }
+    params->frame_duration_us = ret;
+
+    ret = ble_audio_hal_codec_cfg_get_octets_per_frame(codec_cfg);
+    if (ret <= 0)
+    {
+        LOG_ERR("Error: Octets per frame not set, cannot start codec.");
+        return (ret < 0) ? ret : -EINVAL;
+    }
+    params->octets_per_frame = ret;
+
+    params->frames_per_sdu = ble_audio_hal_codec_cfg_get_frame_blocks_per_sdu(codec_cfg);
+
+    return 0;
+}
+
+static int
+source_sdu_send(uint8_t stream_idx, struct net_buf *buf, uint16_t seq_num)
+{
+    return ble_audio_hal_stream_send(&source_ases[stream_idx].stream, buf, seq_num);
 }
+#endif
 
 static int
 lc3_config(struct bt_conn                        *conn,
@@ -158,8 +258,27 @@ lc3_config(struct bt_conn                        *conn,
            struct bt_audio_codec_qos_pref * const pref,
            struct bt_bap_ascs_rsp                *rsp)
 {
-    *stream = stream_alloc(dir);
-    if (*stream == NULL)
+    struct ase_ctx *ase;
+
+#if defined(CONFIG_AUDIO_CODEC_PROFILE_FIXED)
+    {
+        struct lc3_params params;
+
+        if (codec_cfg_parse(codec_cfg, &params) != 0 || params.freq_hz != AUDIO_CODEC_FREQ_HZ
+            || params.frame_duration_us != AUDIO_CODEC_FRAME_DURATION_US
+            || params.octets_per_frame != AUDIO_CODEC_OCTETS_PER_FRAME
+            || params.frames_per_sdu != AUDIO_CODEC_FRAMES_PER_SDU)
+        {
+            LOG_WRN("Codec config does not match the fixed codec profile");
+            *rsp = BT_BAP_ASCS_RSP(BT_BAP_ASCS_RSP_CODE_CONF_UNSUPPORTED, BT_BAP_ASCS_REASON_CODEC_DATA);
+
+            return -ENOTSUP;
+        }
+    }
+#endif
+
+    ase = ase_alloc(dir);
+    if (ase == NULL)
     {
         LOG_ERR("No streams available\n");
         *rsp = BT_BAP_ASCS_RSP(BT_BAP_ASCS_RSP_CODE_NO_MEM, BT_BAP_ASCS_REASON_NONE);
@@ -167,18 +286,13 @@ lc3_config(struct bt_conn                        *conn,
         return -ENOMEM;
     }
 
+    *stream = &ase->stream;
     LOG_INF("ASE Codec Config stream %p\n", *stream);
 
-    if (dir == BT_AUDIO_DIR_SOURCE)
-    {
-        configured_source_stream_count++;
-    }
-
     *pref = qos_pref;
-
 #if defined(CONFIG_LIBLC3)
-    /* Nothing to free as static memory is used */
-    lc3_decoder = NULL;
+    /* Tighter or looser preferences depending on how the link to this peer behaved before */
+    audio_latency_ctrl_qos_pref_get(ble_audio_hal_conn_get_dst(conn), pref);
 #endif
 
     return 0;
@@ -210,14 +324,7 @@ lc3_qos(struct bt_bap_stream *stream, const struct bt_audio_codec_qos *qos, stru
         qos->rtn,
         qos->latency,
         qos->pd);
-    for (size_t i = 0U; i < configured_source_stream_count; i++)
-    {
-        if (stream == &source_streams[i].stream)
-        {
-            source_streams[i].max_sdu = qos->sdu;
-            break;
-        }
-    }
+    ase_get(stream)->max_sdu = qos->sdu;
     return 0;
 }
 
@@ -228,46 +335,45 @@ lc3_enable(struct bt_bap_stream *stream, const uint8_t meta[], size_t meta_len,
 
 #if defined(CONFIG_LIBLC3)
     {
-        int frame_duration_us;
-        int freq;
-        int ret;
-
-        ret = bt_audio_codec_cfg_get_freq(stream->codec_cfg);
-        if (ret > 0)
-        {
-            freq = bt_audio_codec_cfg_freq_to_freq_hz(ret);
-        }
-        else
+        const struct ase_ctx *ase = ase_get(stream);
+        struct lc3_params     params;
+        int                   ret;
+
+#if defined(CONFIG_AUDIO_CODEC_PROFILE_FIXED)
+        /* The codec config was checked against the profile in lc3_config() */
+        params = (struct lc3_params) {
+            .freq_hz           = AUDIO_CODEC_FREQ_HZ,
+            .frame_duration_us = AUDIO_CODEC_FRAME_DURATION_US,
+            .octets_per_frame  = AUDIO_CODEC_OCTETS_PER_FRAME,
+            .frames_per_sdu    = AUDIO_CODEC_FRAMES_PER_SDU,
+        };
+#else
+        ret = codec_cfg_parse(stream->codec_cfg, &params);
+        if (ret != 0)
         {
-            LOG_ERR("Error: Codec frequency not set, cannot start codec.");
             *rsp = BT_BAP_ASCS_RSP(BT_BAP_ASCS_RSP_CODE_CONF_INVALID, BT_BAP_ASCS_REASON_CODEC_DATA);
             return ret;
         }
+#endif
 
-        ret = bt_audio_codec_cfg_get_frame_dur(stream->codec_cfg);
-        if (ret > 0)
+        if (ase->dir == BT_AUDIO_DIR_SINK)
         {
-            frame_duration_us = bt_audio_codec_cfg_frame_dur_to_frame_dur_us(ret);
+            ret = audio_rx_stream_setup(ase->idx, params.freq_hz, params.frame_duration_us, params.frames_per_sdu);
         }
         else
         {
-            LOG_ERR("Error: Frame duration not set, cannot start codec.");
-            *rsp = BT_BAP_ASCS_RSP(BT_BAP_ASCS_RSP_CODE_CONF_INVALID, BT_BAP_ASCS_REASON_CODEC_DATA);
-            return ret;
+            ret = audio_tx_stream_setup(ase->idx,
+                                        source_sdu_send,
+                                        params.freq_hz,
+                                        params.frame_duration_us,
+                                        params.octets_per_frame,
+                                        params.frames_per_sdu);
         }
 
-        frames_per_sdu = bt_audio_codec_cfg_get_frame_blocks_per_sdu(stream->codec_cfg, true);
-
-        lc3_decoder = lc3_setup_decoder(frame_duration_us,
-                                        freq,
-                                        0, /* No resampling */
-                                        &lc3_decoder_mem);
-
-        if (lc3_decoder == NULL)
+        if (ret != 0)
         {
-            LOG_ERR("ERROR: Failed to setup LC3 encoder - wrong parameters?\n");
             *rsp = BT_BAP_ASCS_RSP(BT_BAP_ASCS_RSP_CODE_CONF_INVALID, BT_BAP_ASCS_REASON_CODEC_DATA);
-            return -1;
+            return ret;
         }
     }
 #endif
@@ -280,23 +386,6 @@ lc3_start(struct bt_bap_stream *stream, struct bt_bap_ascs_rsp *rsp)
 {
     printk("Start: stream %p\n", stream);
 
-    for (size_t i = 0U; i < configured_source_stream_count; i++)
-    {
-        if (stream == &source_streams[i].stream)
-        {
-            source_streams[i].seq_num     = 0U;
-            source_streams[i].len_to_send = 0U;
-            break;
-        }
-    }
-
-    if (configured_source_stream_count > 0 && !k_work_delayable_is_pending(&audio_send_work))
-    {
-
-        /* Start send timer */
-        k_work_schedule(&audio_send_work, K_MSEC(0));
-    }
-
     return 0;
 }
 
@@ -324,30 +413,11 @@ lc3_stop(struct bt_bap_stream *stream, struct bt_bap_ascs_rsp *rsp)
 static int
 lc3_release(struct bt_bap_stream *stream, struct bt_bap_ascs_rsp *rsp)
 {
-    LOG_INF("Release: stream %p\n", stream);
-    return 0;
-}
-
-static enum bt_audio_dir
-stream_dir(const struct bt_bap_stream *stream)
-{
-    for (size_t i = 0U; i < ARRAY_SIZE(source_streams); i++)
-    {
-        if (stream == &source_streams[i].stream)
-        {
-            return BT_AUDIO_DIR_SOURCE;
-        }
-    }
-
-    for (size_t i = 0U; i < ARRAY_SIZE(sink_streams); i++)
-    {
-        if (stream == &sink_streams[i])
-        {
-            return BT_AUDIO_DIR_SINK;
-        }
-    }
-
-    __ASSERT(false, "Invalid stream %p", stream);
+    /* The context is handed back once the ASE has reached idle, see stream_released() */
+    LOG_INF("Release: stream %p (%zu sink, %zu source configured)\n",
+            stream,
+            configured_ase_count[BT_AUDIO_DIR_SINK - 1],
+            configured_ase_count[BT_AUDIO_DIR_SOURCE - 1]);
     return 0;
 }
 
@@ -355,56 +425,17 @@ stream_dir(const struct bt_bap_stream *stream)
 static void
 stream_recv_lc3_codec(struct bt_bap_stream *stream, const struct bt_iso_recv_info *info, struct net_buf *buf)
 {
-    const uint8_t *in_buf;
-    uint8_t        err              = -1;
-    const int      octets_per_frame = buf->len / frames_per_sdu;
-
-    if (lc3_decoder == NULL)
-    {
-        LOG_WRN("LC3 decoder not setup, cannot decode data.\n");
-        return;
-    }
-
     if ((info->flags & BT_ISO_FLAGS_VALID) == 0)
     {
-        LOG_WRN("Bad packet: 0x%02X\n", info->flags);
-
-        in_buf = NULL;
-    }
-    else
-    {
-        in_buf = buf->data;
+        LOG_DBG("Bad packet: 0x%02X", info->flags);
     }
 
-    /* This code is to demonstrate the use of the LC3 codec. On an actual implementation
-     * it might be required to offload the processing to another task to avoid blocking the
-     * BT stack.
+    /* Decoding is deferred to the audio RX thread so that the BT stack is not
+     * blocked and all streams are decoded in one burst per SDU interval.
      */
-    for (int i = 0; i < frames_per_sdu; i++)
-    {
-
-        int offset = 0;
-
-        err = lc3_decode(lc3_decoder, in_buf + offset, octets_per_frame, LC3_PCM_FORMAT_S16, audio_buf, 1);
+    audio_rx_sdu_put(ase_get(stream)->idx, info, buf);
 
-        if (in_buf != NULL)
-        {
-            offset += octets_per_frame;
-        }
-    }
-
-    LOG_INF("RX stream %p len %u\n", stream, buf->len);
-
-    if (err == 1)
-    {
-        LOG_INF("  decoder performed PLC\n");
-        return;
-    }
-    else if (err < 0)
-    {
-        LOG_WRN("  decoder failed - wrong parameters?\n");
-        return;
-    }
+    LOG_DBG("RX stream %p len %u", stream, buf->len);
 }
 #else
 static void
@@ -422,14 +453,37 @@ stream_stopped(struct bt_bap_stream *stream, uint8_t reason)
 {
     LOG_INF("Audio Stream %p stopped with reason 0x%02X\n", stream, reason);
 
-    /* Stop send timer */
-    k_work_cancel_delayable(&audio_send_work);
+    ase_stop(ase_get(stream));
 }
 
 static void
 stream_started(struct bt_bap_stream *stream)
 {
-    LOG_INF("Audio Stream %p started\n", stream);
+    struct ase_ctx *ase = ase_get(stream);
+
+    if (ase->started)
+    {
+        return;
+    }
+
+    ase->started = true;
+    started_ase_count++;
+    LOG_INF("Audio Stream %p started (%zu running)\n", stream, started_ase_count);
+
+#if defined(CONFIG_LIBLC3)
+    if (ase->dir == BT_AUDIO_DIR_SINK)
+    {
+        audio_latency_ctrl_stream_start(ase->idx,
+                                        ble_audio_hal_conn_get_dst(stream->conn),
+                                        stream->qos->interval,
+                                        stream->qos->pd);
+        audio_rx_stream_start(ase->idx, stream->qos->pd);
+    }
+    else
+    {
+        audio_tx_stream_start(ase->idx);
+    }
+#endif
 }
 
 static void
@@ -438,9 +492,9 @@ stream_enabled_cb(struct bt_bap_stream *stream)
     /* The unicast server is responsible for starting sink ASEs after the
      * client has enabled them.
      */
-    if (stream_dir(stream) == BT_AUDIO_DIR_SINK)
+    if (ase_get(stream)->dir == BT_AUDIO_DIR_SINK)
     {
-        const int err = bt_bap_stream_start(stream);
+        const int err = ble_audio_hal_stream_start(stream);
 
         if (err != 0)
         {
@@ -449,6 +503,18 @@ stream_enabled_cb(struct bt_bap_stream *stream)
     }
 }
 
+static void
+stream_released(struct bt_bap_stream *stream)
+{
+    struct ase_ctx *ase = ase_get(stream);
+
+    LOG_INF("Audio Stream %p released\n", stream);
+
+    /* An ACL loss can release the ASE without a stop */
+    ase_stop(ase);
+    ase_free(ase);
+}
+
 static int
 set_location(void)
 {
@@ -456,7 +522,7 @@ set_location(void)
 
     if (IS_ENABLED(CONFIG_BT_PAC_SNK_LOC))
     {
-        err = bt_pacs_set_location(BT_AUDIO_DIR_SINK, BT_AUDIO_LOCATION_FRONT_CENTER);
+        err = ble_audio_hal_pacs_set_location(BT_AUDIO_DIR_SINK, BT_AUDIO_LOCATION_FRONT_CENTER);
         if (err != 0)
         {
             printk("Failed to set sink location (err %d)\n", err);
@@ -466,7 +532,8 @@ set_location(void)
 
     if (IS_ENABLED(CONFIG_BT_PAC_SRC_LOC))
     {
-        err = bt_pacs_set_location(BT_AUDIO_DIR_SOURCE, (BT_AUDIO_LOCATION_FRONT_LEFT | BT_AUDIO_LOCATION_FRONT_RIGHT));
+        err = ble_audio_hal_pacs_set_location(BT_AUDIO_DIR_SOURCE,
+                                              (BT_AUDIO_LOCATION_FRONT_LEFT | BT_AUDIO_LOCATION_FRONT_RIGHT));
         if (err != 0)
         {
             printk("Failed to set source location (err %d)\n", err);
@@ -486,7 +553,7 @@ set_supported_contexts(void)
 
     if (IS_ENABLED(CONFIG_BT_PAC_SNK))
     {
-        err = bt_pacs_set_supported_contexts(BT_AUDIO_DIR_SINK, AVAILABLE_SINK_CONTEXT);
+        err = ble_audio_hal_pacs_set_supported_contexts(BT_AUDIO_DIR_SINK, AVAILABLE_SINK_CONTEXT);
         if (err != 0)
         {
             printk("Failed to set sink supported contexts (err %d)\n", err);
@@ -497,7 +564,7 @@ set_supported_contexts(void)
 
     if (IS_ENABLED(CONFIG_BT_PAC_SRC))
     {
-        err = bt_pacs_set_supported_contexts(BT_AUDIO_DIR_SOURCE, AVAILABLE_SOURCE_CONTEXT);
+        err = ble_audio_hal_pacs_set_supported_contexts(BT_AUDIO_DIR_SOURCE, AVAILABLE_SOURCE_CONTEXT);
         if (err != 0)
         {
             printk("Failed to set source supported contexts (err %d)\n", err);
@@ -518,7 +585,7 @@ set_available_contexts(void)
 
     if (IS_ENABLED(CONFIG_BT_PAC_SNK))
     {
-        err = bt_pacs_set_available_contexts(BT_AUDIO_DIR_SINK, AVAILABLE_SINK_CONTEXT);
+        err = ble_audio_hal_pacs_set_available_contexts(BT_AUDIO_DIR_SINK, AVAILABLE_SINK_CONTEXT);
         if (err != 0)
         {
             printk("Failed to set sink available contexts (err %d)\n", err);
@@ -528,7 +595,7 @@ set_available_contexts(void)
 
     if (IS_ENABLED(CONFIG_BT_PAC_SRC))
     {
-        err = bt_pacs_set_available_contexts(BT_AUDIO_DIR_SOURCE, AVAILABLE_SOURCE_CONTEXT);
+        err = ble_audio_hal_pacs_set_available_contexts(BT_AUDIO_DIR_SOURCE, AVAILABLE_SOURCE_CONTEXT);
         if (err != 0)
         {
             printk("Failed to set source available contexts (err %d)\n", err);
@@ -558,20 +625,28 @@ void
 ble_bap_unicast_server_start(void)
 {
     int err;
-    bt_bap_unicast_server_register(&param);
-    bt_bap_unicast_server_register_cb(&unicast_server_cb);
+    ble_audio_hal_server_register(&param);
+    ble_audio_hal_server_register_cb(&unicast_server_cb);
 
-    bt_pacs_cap_register(BT_AUDIO_DIR_SINK, &cap_sink);
-    bt_pacs_cap_register(BT_AUDIO_DIR_SOURCE, &cap_source);
+    ble_audio_hal_pacs_cap_register(BT_AUDIO_DIR_SINK, &cap_sink);
+    ble_audio_hal_pacs_cap_register(BT_AUDIO_DIR_SOURCE, &cap_source);
 
-    for (size_t i = 0; i < ARRAY_SIZE(sink_streams); i++)
+    sys_slist_init(&free_sink_ases);
+    for (size_t i = 0; i < ARRAY_SIZE(sink_ases); i++)
     {
-        bt_bap_stream_cb_register(&sink_streams[i], &stream_ops);
+        sink_ases[i].dir = BT_AUDIO_DIR_SINK;
+        sink_ases[i].idx = i;
+        ble_audio_hal_stream_cb_register(&sink_ases[i].stream, &stream_ops);
+        sys_slist_append(&free_sink_ases, &sink_ases[i].node);
     }
 
-    for (size_t i = 0; i < ARRAY_SIZE(source_streams); i++)
+    sys_slist_init(&free_source_ases);
+    for (size_t i = 0; i < ARRAY_SIZE(source_ases); i++)
     {
-        bt_bap_stream_cb_register(&source_streams[i].stream, &stream_ops);
+        source_ases[i].dir = BT_AUDIO_DIR_SOURCE;
+        source_ases[i].idx = i;
+        ble_audio_hal_stream_cb_register(&source_ases[i].stream, &stream_ops);
+        sys_slist_append(&free_source_ases, &source_ases[i].node);
     }
 
     err = set_location();
@@ -46,6 +46,7 @@ BT_GATT_SERVICE_DEFINE(dis_svc,
 // --- static functions declarations -------------------------------------------
 static void connected(struct bt_conn *conn, uint8_t err);
 static void disconnected(struct bt_conn *conn, uint8_t reason);
+static void adv_slow_work_handler(struct k_work *work);
 
 // --- static variables definitions --------------------------------------------
 static struct bt_conn *ble_connection;
@@ -54,6 +55,22 @@ static K_SEM_DEFINE(sem_connected, 0U, 1U);
 static K_SEM_DEFINE(sem_disconnected, 0U, 1U);
 struct bt_le_ext_adv *adv;
 
+static K_WORK_DELAYABLE_DEFINE(adv_slow_work, adv_slow_work_handler);
+
+/* Fast advertising to get discovered quickly, slow advertising to save power
+ * once nobody connected within CONFIG_BLE_ADV_FAST_TIMEOUT_S.
+ */
+static const struct bt_le_adv_param adv_param_fast = BT_LE_ADV_PARAM_INIT(BT_LE_ADV_OPT_EXT_ADV
+                                                                              | BT_LE_ADV_OPT_CONNECTABLE,
+                                                                          BT_GAP_ADV_FAST_INT_MIN_2,
+                                                                          BT_GAP_ADV_FAST_INT_MAX_2,
+                                                                          NULL);
+static const struct bt_le_adv_param adv_param_slow = BT_LE_ADV_PARAM_INIT(BT_LE_ADV_OPT_EXT_ADV
+                                                                              | BT_LE_ADV_OPT_CONNECTABLE,
+                                                                          BT_GAP_ADV_SLOW_INT_MIN,
+                                                                          BT_GAP_ADV_SLOW_INT_MAX,
+                                                                          NULL);
+
 static uint8_t unicast_server_addata[] = {
     BT_UUID_16_ENCODE(BT_UUID_ASCS_VAL),    /* ASCS UUID */
     BT_AUDIO_UNICAST_ANNOUNCEMENT_TARGETED, /* Target Announcement */
@@ -79,7 +96,9 @@ BT_CONN_CB_DEFINE(conn_callbacks) = {
 static void
 connected(struct bt_conn *conn, uint8_t err)
 {
-    char addr[BT_ADDR_LE_STR_LEN];
+    char               addr[BT_ADDR_LE_STR_LEN];
+    struct k_work_sync sync;
+    int                ret;
 
     bt_addr_le_to_str(bt_conn_get_dst(conn), addr, sizeof(addr));
 
@@ -92,6 +111,19 @@ connected(struct bt_conn *conn, uint8_t err)
 
     LOG_INF("Connected: %s", addr);
     ble_connection = bt_conn_ref(conn);
+
+    /* A handler that was already running may have restarted the set after
+     * the connection stopped it, stop it again once the handler is done.
+     */
+    if (k_work_cancel_delayable_sync(&adv_slow_work, &sync))
+    {
+        ret = bt_le_ext_adv_stop(adv);
+        if (ret)
+        {
+            LOG_ERR("Failed to stop advertising set (err %d)\n", ret);
+        }
+    }
+
     k_sem_give(&sem_connected);
 }
 
@@ -112,22 +144,34 @@ disconnected(struct bt_conn *conn, uint8_t reason)
     k_sem_give(&sem_disconnected);
 }
 
-void
-start_adv(void)
+static void
+adv_slow_work_handler(struct k_work *work)
 {
     int err;
-    /* Create a connectable advertising set */
-    err = bt_le_ext_adv_create(BT_LE_EXT_ADV_CONN, NULL, &adv);
+
+    if (ble_connection != NULL)
+    {
+        /* Connected while the work was pending, the set stopped advertising already */
+        return;
+    }
+
+    err = bt_le_ext_adv_stop(adv);
     if (err)
     {
-        LOG_ERR("Failed to create advertising set (err %d)\n", err);
+        LOG_ERR("Failed to stop advertising set (err %d)\n", err);
         return;
     }
 
-    err = bt_le_ext_adv_set_data(adv, ad, ARRAY_SIZE(ad), NULL, 0);
+    if (ble_connection != NULL)
+    {
+        /* Connected while stopping, advertising must stay off */
+        return;
+    }
+
+    err = bt_le_ext_adv_update_param(adv, &adv_param_slow);
     if (err)
     {
-        LOG_ERR("Failed to set advertising data (err %d)\n", err);
+        LOG_ERR("Failed to update advertising parameters (err %d)\n", err);
         return;
     }
 
@@ -137,6 +181,50 @@ start_adv(void)
         LOG_ERR("Failed to start advertising set (err %d)\n", err);
         return;
     }
+
+    LOG_INF("Switched to slow advertising");
+}
+
+void
+start_adv(void)
+{
+    int err;
+
+    if (adv == NULL)
+    {
+        /* Create a connectable advertising set, it is reused after every disconnection */
+        err = bt_le_ext_adv_create(&adv_param_fast, NULL, &adv);
+        if (err)
+        {
+            LOG_ERR("Failed to create advertising set (err %d)\n", err);
+            return;
+        }
+
+        err = bt_le_ext_adv_set_data(adv, ad, ARRAY_SIZE(ad), NULL, 0);
+        if (err)
+        {
+            LOG_ERR("Failed to set advertising data (err %d)\n", err);
+            return;
+        }
+    }
+    else
+    {
+        err = bt_le_ext_adv_update_param(adv, &adv_param_fast);
+        if (err)
+        {
+            LOG_ERR("Failed to update advertising parameters (err %d)\n", err);
+            return;
+        }
+    }
+
+    err = bt_le_ext_adv_start(adv, BT_LE_EXT_ADV_START_DEFAULT);
+    if (err)
+    {
+        LOG_ERR("Failed to start advertising set (err %d)\n", err);
+        return;
+    }
+
+    k_work_reschedule(&adv_slow_work, K_SECONDS(CONFIG_BLE_ADV_FAST_TIMEOUT_S));
 }
 
 // --- Functions Definitions ---------------------------------------------------
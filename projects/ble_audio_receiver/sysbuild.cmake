@@ -0,0 +1,30 @@
+#
+# Single source of truth for the ASE counts, see Kconfig.sysbuild
+#
+
+math(EXPR ase_iso_chan_count "${SB_CONFIG_APP_ASE_SNK_COUNT} + ${SB_CONFIG_APP_ASE_SRC_COUNT}")
+math(EXPR ase_iso_tx_buf_count "${SB_CONFIG_APP_ASE_SRC_COUNT} * ${SB_CONFIG_APP_ISO_TX_BUF_PER_ASE}")
+
+set(ase_images ${DEFAULT_IMAGE})
+if(SB_CONFIG_NRF_DEFAULT_IPC_RADIO)
+  list(APPEND ase_images ipc_radio)
+endif()
+
+foreach(image ${ase_images})
+  set_config_int(${image} CONFIG_BT_ASCS_MAX_ASE_SNK_COUNT ${SB_CONFIG_APP_ASE_SNK_COUNT})
+  set_config_int(${image} CONFIG_BT_ASCS_MAX_ASE_SRC_COUNT ${SB_CONFIG_APP_ASE_SRC_COUNT})
+  set_config_int(${image} CONFIG_BT_ISO_MAX_CHAN ${ase_iso_chan_count})
+  set_config_int(${image} CONFIG_BT_ISO_TX_BUF_COUNT ${ase_iso_tx_buf_count})
+
+  # All ASEs of a peer share one CIG, the controller has to hold a CIS for each
+  if(image STREQUAL "ipc_radio")
+    set_config_int(${image} CONFIG_BT_CTLR_CONN_ISO_STREAMS ${ase_iso_chan_count})
+    set_config_int(${image} CONFIG_BT_CTLR_CONN_ISO_STREAMS_PER_GROUP ${ase_iso_chan_count})
+  endif()
+endforeach()
+
+# Received SDUs are copied out in the recv callback, one buffer per sink is enough
+set_config_int(${DEFAULT_IMAGE} CONFIG_BT_ISO_RX_BUF_COUNT ${SB_CONFIG_APP_ASE_SNK_COUNT})
+
+message(STATUS "ASEs: ${SB_CONFIG_APP_ASE_SNK_COUNT} sink, ${SB_CONFIG_APP_ASE_SRC_COUNT} source, "
+               "${ase_iso_chan_count} ISO channels")
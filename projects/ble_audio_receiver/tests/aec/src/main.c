@@ -0,0 +1,118 @@
+// --- includes ----------------------------------------------------------------
+#include "audio/audio_aec.h"
+#include "audio/audio_codec_profile.h"
+
+#include <errno.h>
+#include <zephyr/ztest.h>
+
+// --- defines -----------------------------------------------------------------
+#define RATE_HZ      48000U
+#define FRAME_US     10000U
+#define FRAME_LEN    ((RATE_HZ * FRAME_US) / USEC_PER_SEC)
+#define RENDER_TS_US 100000U
+
+// --- static functions declarations -------------------------------------------
+static void ramp_fill(int16_t *pcm, size_t samples, int16_t first);
+static void aec_before(void *fixture);
+
+// --- static variables definitions --------------------------------------------
+static int16_t rendered[2][AUDIO_MAX_NUM_SAMPLES];
+static int16_t ref[AUDIO_MAX_NUM_SAMPLES];
+
+// --- static functions definitions --------------------------------------------
+static void
+ramp_fill(int16_t *pcm, size_t samples, int16_t first)
+{
+    for (size_t i = 0U; i < samples; i++)
+    {
+        pcm[i] = (int16_t)(first + (int16_t)i);
+    }
+}
+
+static void
+aec_before(void *fixture)
+{
+    ARG_UNUSED(fixture);
+
+    audio_aec_ref_reset();
+    ramp_fill(rendered[0], FRAME_LEN, 1);
+    ramp_fill(rendered[1], FRAME_LEN, 1 + (int16_t)FRAME_LEN);
+    memset(ref, 0x55, sizeof(ref));
+}
+
+ZTEST_SUITE(aec, NULL, NULL, aec_before, NULL, NULL);
+
+// --- test cases --------------------------------------------------------------
+ZTEST(aec, test_ref_aligned)
+{
+    audio_aec_ref_put(RENDER_TS_US, rendered[0], FRAME_LEN, RATE_HZ);
+
+    zassert_ok(audio_aec_ref_get(RENDER_TS_US, ref, FRAME_LEN, RATE_HZ));
+    zassert_mem_equal(ref, rendered[0], FRAME_LEN * sizeof(ref[0]));
+}
+
+ZTEST(aec, test_ref_spans_frames)
+{
+    const size_t skip = FRAME_LEN / 4U;
+
+    audio_aec_ref_put(RENDER_TS_US, rendered[0], FRAME_LEN, RATE_HZ);
+    audio_aec_ref_put(RENDER_TS_US + FRAME_US, rendered[1], FRAME_LEN, RATE_HZ);
+
+    /* Capture a quarter frame after the first render time */
+    zassert_ok(audio_aec_ref_get(RENDER_TS_US + (FRAME_US / 4U), ref, FRAME_LEN, RATE_HZ));
+    zassert_mem_equal(ref, &rendered[0][skip], (FRAME_LEN - skip) * sizeof(ref[0]));
+    zassert_mem_equal(&ref[FRAME_LEN - skip], rendered[1], skip * sizeof(ref[0]));
+}
+
+ZTEST(aec, test_ref_partly_rendered)
+{
+    const size_t half = FRAME_LEN / 2U;
+
+    audio_aec_ref_put(RENDER_TS_US, rendered[0], FRAME_LEN, RATE_HZ);
+
+    zassert_ok(audio_aec_ref_get(RENDER_TS_US + (FRAME_US / 2U), ref, FRAME_LEN, RATE_HZ));
+    zassert_mem_equal(ref, &rendered[0][half], half * sizeof(ref[0]));
+    for (size_t i = half; i < FRAME_LEN; i++)
+    {
+        zassert_equal(ref[i], 0, "Sample %zu not silent", i);
+    }
+}
+
+ZTEST(aec, test_ref_missing)
+{
+    zassert_equal(audio_aec_ref_get(RENDER_TS_US, ref, FRAME_LEN, RATE_HZ), -ENODATA);
+    for (size_t i = 0U; i < FRAME_LEN; i++)
+    {
+        zassert_equal(ref[i], 0, "Sample %zu not silent", i);
+    }
+}
+
+ZTEST(aec, test_ref_rate_mismatch)
+{
+    const uint32_t tx_rate_hz = 16000U;
+    const size_t   tx_len     = (tx_rate_hz * FRAME_US) / USEC_PER_SEC;
+
+    /* Downlink at 48 kHz, uplink at 16 kHz: offsets at the uplink rate must
+     * not index the downlink frame.
+     */
+    audio_aec_ref_put(RENDER_TS_US, rendered[0], FRAME_LEN, RATE_HZ);
+
+    zassert_equal(audio_aec_ref_get(RENDER_TS_US + (FRAME_US / 2U), ref, tx_len, tx_rate_hz), -ENODATA);
+    for (size_t i = 0U; i < tx_len; i++)
+    {
+        zassert_equal(ref[i], 0, "Sample %zu not silent", i);
+    }
+}
+
+ZTEST(aec, test_ref_rate_change_replaces_slot)
+{
+    const uint32_t rate_hz = 16000U;
+    const size_t   len     = (rate_hz * FRAME_US) / USEC_PER_SEC;
+
+    /* Same render time after a reconfiguration, must not mix the two rates */
+    audio_aec_ref_put(RENDER_TS_US, rendered[0], FRAME_LEN, RATE_HZ);
+    audio_aec_ref_put(RENDER_TS_US, rendered[1], len, rate_hz);
+
+    zassert_ok(audio_aec_ref_get(RENDER_TS_US, ref, len, rate_hz));
+    zassert_mem_equal(ref, rendered[1], len * sizeof(ref[0]));
+}
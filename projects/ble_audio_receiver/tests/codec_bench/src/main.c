@@ -0,0 +1,155 @@
+// --- includes ----------------------------------------------------------------
+#include "audio/audio_codec_hal.h"
+#include "audio/audio_rx.h"
+#include "audio/audio_tx.h"
+#include "host_clock.h"
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+// --- defines -----------------------------------------------------------------
+/* The generic profile is run with the defaults of the fixed one, so that both
+ * decode the same SDU set.
+ */
+#define BENCH_FREQ_HZ           48000
+#define BENCH_FRAME_DURATION_US 10000
+#define BENCH_OCTETS_PER_FRAME  120
+#define BENCH_FRAMES_PER_SDU    1
+#define BENCH_SDU_LEN           (BENCH_OCTETS_PER_FRAME * BENCH_FRAMES_PER_SDU)
+#define BENCH_SDU_INTERVAL_US   (BENCH_FRAME_DURATION_US * BENCH_FRAMES_PER_SDU)
+#define BENCH_PD_US             CONFIG_BLE_BAP_PD_MIN_US
+#define BENCH_FRAME_SAMPLES     ((BENCH_FREQ_HZ / 1000) * (BENCH_FRAME_DURATION_US / 1000))
+
+#define BENCH_SDU_COUNT 10000U
+/* Distinct SDUs, cycled through so the decoder does not see a steady state */
+#define BENCH_SET_COUNT 50U
+/* SDUs queued per SDU interval, one stream's share of the SDU pool */
+#define BENCH_BATCH     CONFIG_AUDIO_RX_SDU_BUF_PER_STREAM
+#define BENCH_STREAM    0U
+
+#if defined(CONFIG_AUDIO_CODEC_PROFILE_FIXED)
+#define BENCH_PROFILE "fixed"
+
+BUILD_ASSERT(AUDIO_CODEC_FREQ_HZ == BENCH_FREQ_HZ && AUDIO_CODEC_FRAME_DURATION_US == BENCH_FRAME_DURATION_US
+                 && AUDIO_CODEC_OCTETS_PER_FRAME == BENCH_OCTETS_PER_FRAME
+                 && AUDIO_CODEC_FRAMES_PER_SDU == BENCH_FRAMES_PER_SDU,
+             "Both profiles must decode the same SDU set");
+#else
+#define BENCH_PROFILE "generic"
+#endif
+
+// --- static functions declarations -------------------------------------------
+static void  pcm_generate(int16_t *pcm, uint32_t sdu, uint32_t *seed);
+static void *codec_bench_setup(void);
+
+// --- static variables definitions --------------------------------------------
+static audio_encoder_mem_t encoder_mem;
+static uint8_t             sdu_set[BENCH_SET_COUNT][BENCH_SDU_LEN];
+
+// --- static functions definitions --------------------------------------------
+static void
+pcm_generate(int16_t *pcm, uint32_t sdu, uint32_t *seed)
+{
+    /* Triangle wave with a period that changes per SDU, plus noise */
+    const int32_t period = 24 + (int32_t)(sdu % 40U);
+
+    for (int n = 0; n < BENCH_FRAME_SAMPLES; n++)
+    {
+        const int32_t phase = n % period;
+        const int32_t tri   = ((phase < (period / 2)) ? phase : (period - phase)) * (16000 / period);
+
+        *seed  = (*seed * 1103515245U) + 12345U;
+        pcm[n] = (int16_t)(tri - 4000 + (int32_t)((*seed >> 16) % 2048U) - 1024);
+    }
+}
+
+static void *
+codec_bench_setup(void)
+{
+    static int16_t pcm[BENCH_FRAME_SAMPLES];
+    lc3_encoder_t  encoder;
+    uint32_t       seed = 1U;
+
+    /* Same deterministic SDU set on every run and with both profiles */
+    encoder = audio_codec_hal_encoder_setup(BENCH_FRAME_DURATION_US, BENCH_FREQ_HZ, &encoder_mem);
+    zassert_not_null(encoder);
+
+    for (uint32_t i = 0U; i < BENCH_SET_COUNT; i++)
+    {
+        for (int f = 0; f < BENCH_FRAMES_PER_SDU; f++)
+        {
+            uint8_t *frame = &sdu_set[i][f * BENCH_OCTETS_PER_FRAME];
+
+            pcm_generate(pcm, i, &seed);
+            zassert_ok(audio_codec_hal_encode(encoder, pcm, BENCH_OCTETS_PER_FRAME, frame));
+        }
+    }
+
+    zassert_ok(audio_rx_stream_setup(BENCH_STREAM, BENCH_FREQ_HZ, BENCH_FRAME_DURATION_US, BENCH_FRAMES_PER_SDU));
+
+    return NULL;
+}
+
+ZTEST_SUITE(codec_bench, NULL, codec_bench_setup, NULL, NULL, NULL);
+
+// --- functions definitions ---------------------------------------------------
+void
+audio_tx_process(void)
+{
+    /* No uplink, only the downlink decode path is measured */
+}
+
+// --- test cases --------------------------------------------------------------
+ZTEST(codec_bench, test_decode_cycles_per_sdu)
+{
+    struct bt_iso_recv_info info = { .flags = BT_ISO_FLAGS_VALID | BT_ISO_FLAGS_TS };
+    struct net_buf          sdu  = { .len = BENCH_SDU_LEN };
+    struct audio_rx_stats   stats;
+    uint64_t                start_cycles;
+    uint64_t                start_ns;
+    uint64_t                cycles;
+    uint64_t                ns;
+
+    audio_rx_stream_start(BENCH_STREAM, BENCH_PD_US);
+
+    start_cycles = host_clock_cycles();
+    start_ns     = host_clock_ns();
+
+    for (uint32_t n = 0U; n < BENCH_SDU_COUNT; n += BENCH_BATCH)
+    {
+        for (uint32_t i = n; i < MIN(n + BENCH_BATCH, BENCH_SDU_COUNT); i++)
+        {
+            info.seq_num = (uint16_t)i;
+            info.ts      = i * BENCH_SDU_INTERVAL_US;
+            sdu.data     = sdu_set[i % BENCH_SET_COUNT];
+            audio_rx_sdu_put(BENCH_STREAM, &info, &sdu);
+        }
+
+        /* Decoded by the RX thread on the next SDU interval tick */
+        k_sleep(K_USEC(BENCH_SDU_INTERVAL_US));
+    }
+
+    /* Let the last batch be decoded */
+    k_sleep(K_USEC(BENCH_SDU_INTERVAL_US));
+
+    cycles = host_clock_cycles() - start_cycles;
+    ns     = host_clock_ns() - start_ns;
+
+    audio_rx_stats_get(BENCH_STREAM, &stats);
+    audio_rx_stream_stop(BENCH_STREAM);
+
+    /* A dropped or concealed SDU is cheaper and would flatter the result */
+    zassert_equal(stats.decoded_sdus, BENCH_SDU_COUNT, "Decoded %u SDUs", stats.decoded_sdus);
+    zassert_equal(stats.plc_frames, 0U, "Concealed %u frames", stats.plc_frames);
+    zassert_equal(stats.dropped_sdus, 0U, "Dropped %u SDUs", stats.dropped_sdus);
+
+    TC_PRINT("codec_bench: %s profile, %u SDUs of %u octets at %u Hz\n",
+             BENCH_PROFILE,
+             BENCH_SDU_COUNT,
+             BENCH_SDU_LEN,
+             BENCH_FREQ_HZ);
+    TC_PRINT("codec_bench: %s profile, %llu cycles per SDU, %llu ns per SDU\n",
+             BENCH_PROFILE,
+             (unsigned long long)(cycles / BENCH_SDU_COUNT),
+             (unsigned long long)(ns / BENCH_SDU_COUNT));
+}
@@ -0,0 +1,55 @@
+// --- includes ----------------------------------------------------------------
+#include "audio_codec_hal_fakes.h"
+
+#include <zephyr/sys_clock.h>
+
+// --- static functions declarations -------------------------------------------
+static lc3_decoder_t decoder_setup_custom(int frame_duration_us, int freq_hz, audio_decoder_mem_t *mem);
+static lc3_encoder_t encoder_setup_custom(int frame_duration_us, int freq_hz, audio_encoder_mem_t *mem);
+static int           decode_custom(lc3_decoder_t decoder, const void *in, int nbytes, int16_t *pcm);
+static int           frame_samples_custom(int frame_duration_us, int freq_hz);
+
+// --- fakes -------------------------------------------------------------------
+DEFINE_FAKE_VALUE_FUNC(lc3_decoder_t, audio_codec_hal_decoder_setup, int, int, audio_decoder_mem_t *);
+DEFINE_FAKE_VALUE_FUNC(lc3_encoder_t, audio_codec_hal_encoder_setup, int, int, audio_encoder_mem_t *);
+DEFINE_FAKE_VALUE_FUNC(int, audio_codec_hal_decode, lc3_decoder_t, const void *, int, int16_t *);
+DEFINE_FAKE_VALUE_FUNC(int, audio_codec_hal_encode, lc3_encoder_t, const int16_t *, int, void *);
+DEFINE_FAKE_VALUE_FUNC(int, audio_codec_hal_frame_samples, int, int);
+
+// --- static functions definitions --------------------------------------------
+static lc3_decoder_t
+decoder_setup_custom(int frame_duration_us, int freq_hz, audio_decoder_mem_t *mem)
+{
+    return (lc3_decoder_t)mem;
+}
+
+static lc3_encoder_t
+encoder_setup_custom(int frame_duration_us, int freq_hz, audio_encoder_mem_t *mem)
+{
+    return (lc3_encoder_t)mem;
+}
+
+static int
+decode_custom(lc3_decoder_t decoder, const void *in, int nbytes, int16_t *pcm)
+{
+    /* Like liblc3: 1 when the frame was concealed */
+    return (in == NULL) ? 1 : 0;
+}
+
+static int
+frame_samples_custom(int frame_duration_us, int freq_hz)
+{
+    return (int)(((int64_t)frame_duration_us * freq_hz) / USEC_PER_SEC);
+}
+
+// --- functions definitions ---------------------------------------------------
+void
+audio_codec_hal_fakes_reset(void)
+{
+    AUDIO_CODEC_HAL_FFF_FAKES_LIST(RESET_FAKE);
+
+    audio_codec_hal_decoder_setup_fake.custom_fake = decoder_setup_custom;
+    audio_codec_hal_encoder_setup_fake.custom_fake = encoder_setup_custom;
+    audio_codec_hal_decode_fake.custom_fake        = decode_custom;
+    audio_codec_hal_frame_samples_fake.custom_fake = frame_samples_custom;
+}
@@ -0,0 +1,29 @@
+#ifndef AUDIO_CODEC_HAL_FAKES_H
+#define AUDIO_CODEC_HAL_FAKES_H
+
+// --- includes ----------------------------------------------------------------
+#include "audio/audio_codec_hal.h"
+
+#include <zephyr/fff.h>
+
+// --- defines -----------------------------------------------------------------
+#define AUDIO_CODEC_HAL_FFF_FAKES_LIST(FAKE)                                                                           \
+    FAKE(audio_codec_hal_decoder_setup)                                                                                \
+    FAKE(audio_codec_hal_encoder_setup)                                                                                \
+    FAKE(audio_codec_hal_decode)                                                                                       \
+    FAKE(audio_codec_hal_encode)                                                                                       \
+    FAKE(audio_codec_hal_frame_samples)
+
+// --- functions declarations --------------------------------------------------
+DECLARE_FAKE_VALUE_FUNC(lc3_decoder_t, audio_codec_hal_decoder_setup, int, int, audio_decoder_mem_t *);
+DECLARE_FAKE_VALUE_FUNC(lc3_encoder_t, audio_codec_hal_encoder_setup, int, int, audio_encoder_mem_t *);
+DECLARE_FAKE_VALUE_FUNC(int, audio_codec_hal_decode, lc3_decoder_t, const void *, int, int16_t *);
+DECLARE_FAKE_VALUE_FUNC(int, audio_codec_hal_encode, lc3_encoder_t, const int16_t *, int, void *);
+DECLARE_FAKE_VALUE_FUNC(int, audio_codec_hal_frame_samples, int, int);
+
+/* Resets every fake. Codec handles point into the memory handed to setup,
+ * decoding conceals lost frames and the frame size follows the parameters.
+ */
+void audio_codec_hal_fakes_reset(void);
+
+#endif // AUDIO_CODEC_HAL_FAKES_H
@@ -0,0 +1,54 @@
+// --- includes ----------------------------------------------------------------
+#include "ble_audio_hal_fakes.h"
+
+// --- static functions declarations -------------------------------------------
+static int                 stream_send_custom(struct bt_bap_stream *stream, struct net_buf *buf, uint16_t seq_num);
+static const bt_addr_le_t *conn_get_dst_custom(const struct bt_conn *conn);
+
+// --- static variables definitions --------------------------------------------
+static const bt_addr_le_t fake_peer = { .type = BT_ADDR_LE_RANDOM, .a = { .val = { 0x01, 0x02, 0x03, 0x04, 0x05, 0xC0 } } };
+
+// --- fakes -------------------------------------------------------------------
+DEFINE_FAKE_VALUE_FUNC(int, ble_audio_hal_server_register, const struct bt_bap_unicast_server_register_param *);
+DEFINE_FAKE_VALUE_FUNC(int, ble_audio_hal_server_register_cb, const struct bt_bap_unicast_server_cb *);
+DEFINE_FAKE_VALUE_FUNC(int, ble_audio_hal_pacs_cap_register, enum bt_audio_dir, struct bt_pacs_cap *);
+DEFINE_FAKE_VALUE_FUNC(int, ble_audio_hal_pacs_set_location, enum bt_audio_dir, enum bt_audio_location);
+DEFINE_FAKE_VALUE_FUNC(int, ble_audio_hal_pacs_set_supported_contexts, enum bt_audio_dir, enum bt_audio_context);
+DEFINE_FAKE_VALUE_FUNC(int, ble_audio_hal_pacs_set_available_contexts, enum bt_audio_dir, enum bt_audio_context);
+DEFINE_FAKE_VOID_FUNC(ble_audio_hal_stream_cb_register, struct bt_bap_stream *, struct bt_bap_stream_ops *);
+DEFINE_FAKE_VALUE_FUNC(int, ble_audio_hal_stream_start, struct bt_bap_stream *);
+DEFINE_FAKE_VALUE_FUNC(int, ble_audio_hal_stream_send, struct bt_bap_stream *, struct net_buf *, uint16_t);
+DEFINE_FAKE_VALUE_FUNC(int, ble_audio_hal_codec_cfg_get_freq_hz, const struct bt_audio_codec_cfg *);
+DEFINE_FAKE_VALUE_FUNC(int, ble_audio_hal_codec_cfg_get_frame_dur_us, const struct bt_audio_codec_cfg *);
+DEFINE_FAKE_VALUE_FUNC(int, ble_audio_hal_codec_cfg_get_octets_per_frame, const struct bt_audio_codec_cfg *);
+DEFINE_FAKE_VALUE_FUNC(int, ble_audio_hal_codec_cfg_get_frame_blocks_per_sdu, const struct bt_audio_codec_cfg *);
+DEFINE_FAKE_VALUE_FUNC(const bt_addr_le_t *, ble_audio_hal_conn_get_dst, const struct bt_conn *);
+
+// --- static functions definitions --------------------------------------------
+static int
+stream_send_custom(struct bt_bap_stream *stream, struct net_buf *buf, uint16_t seq_num)
+{
+    /* Sent right away, the stack would release the buffer on completion */
+    net_buf_unref(buf);
+    return 0;
+}
+
+static const bt_addr_le_t *
+conn_get_dst_custom(const struct bt_conn *conn)
+{
+    return &fake_peer;
+}
+
+// --- functions definitions ---------------------------------------------------
+void
+ble_audio_hal_fakes_reset(void)
+{
+    BLE_AUDIO_HAL_FFF_FAKES_LIST(RESET_FAKE);
+
+    ble_audio_hal_stream_send_fake.custom_fake                       = stream_send_custom;
+    ble_audio_hal_conn_get_dst_fake.custom_fake                      = conn_get_dst_custom;
+    ble_audio_hal_codec_cfg_get_freq_hz_fake.return_val              = 48000;
+    ble_audio_hal_codec_cfg_get_frame_dur_us_fake.return_val         = 10000;
+    ble_audio_hal_codec_cfg_get_octets_per_frame_fake.return_val     = 120;
+    ble_audio_hal_codec_cfg_get_frame_blocks_per_sdu_fake.return_val = 1;
+}
@@ -0,0 +1,47 @@
+#ifndef BLE_AUDIO_HAL_FAKES_H
+#define BLE_AUDIO_HAL_FAKES_H
+
+// --- includes ----------------------------------------------------------------
+#include "ble/ble_audio_hal.h"
+
+#include <zephyr/fff.h>
+
+// --- defines -----------------------------------------------------------------
+#define BLE_AUDIO_HAL_FFF_FAKES_LIST(FAKE)                                                                             \
+    FAKE(ble_audio_hal_server_register)                                                                                \
+    FAKE(ble_audio_hal_server_register_cb)                                                                             \
+    FAKE(ble_audio_hal_pacs_cap_register)                                                                              \
+    FAKE(ble_audio_hal_pacs_set_location)                                                                              \
+    FAKE(ble_audio_hal_pacs_set_supported_contexts)                                                                    \
+    FAKE(ble_audio_hal_pacs_set_available_contexts)                                                                    \
+    FAKE(ble_audio_hal_stream_cb_register)                                                                             \
+    FAKE(ble_audio_hal_stream_start)                                                                                   \
+    FAKE(ble_audio_hal_stream_send)                                                                                    \
+    FAKE(ble_audio_hal_codec_cfg_get_freq_hz)                                                                          \
+    FAKE(ble_audio_hal_codec_cfg_get_frame_dur_us)                                                                     \
+    FAKE(ble_audio_hal_codec_cfg_get_octets_per_frame)                                                                 \
+    FAKE(ble_audio_hal_codec_cfg_get_frame_blocks_per_sdu)                                                             \
+    FAKE(ble_audio_hal_conn_get_dst)
+
+// --- functions declarations --------------------------------------------------
+DECLARE_FAKE_VALUE_FUNC(int, ble_audio_hal_server_register, const struct bt_bap_unicast_server_register_param *);
+DECLARE_FAKE_VALUE_FUNC(int, ble_audio_hal_server_register_cb, const struct bt_bap_unicast_server_cb *);
+DECLARE_FAKE_VALUE_FUNC(int, ble_audio_hal_pacs_cap_register, enum bt_audio_dir, struct bt_pacs_cap *);
+DECLARE_FAKE_VALUE_FUNC(int, ble_audio_hal_pacs_set_location, enum bt_audio_dir, enum bt_audio_location);
+DECLARE_FAKE_VALUE_FUNC(int, ble_audio_hal_pacs_set_supported_contexts, enum bt_audio_dir, enum bt_audio_context);
+DECLARE_FAKE_VALUE_FUNC(int, ble_audio_hal_pacs_set_available_contexts, enum bt_audio_dir, enum bt_audio_context);
+DECLARE_FAKE_VOID_FUNC(ble_audio_hal_stream_cb_register, struct bt_bap_stream *, struct bt_bap_stream_ops *);
+DECLARE_FAKE_VALUE_FUNC(int, ble_audio_hal_stream_start, struct bt_bap_stream *);
+DECLARE_FAKE_VALUE_FUNC(int, ble_audio_hal_stream_send, struct bt_bap_stream *, struct net_buf *, uint16_t);
+DECLARE_FAKE_VALUE_FUNC(int, ble_audio_hal_codec_cfg_get_freq_hz, const struct bt_audio_codec_cfg *);
+DECLARE_FAKE_VALUE_FUNC(int, ble_audio_hal_codec_cfg_get_frame_dur_us, const struct bt_audio_codec_cfg *);
+DECLARE_FAKE_VALUE_FUNC(int, ble_audio_hal_codec_cfg_get_octets_per_frame, const struct bt_audio_codec_cfg *);
+DECLARE_FAKE_VALUE_FUNC(int, ble_audio_hal_codec_cfg_get_frame_blocks_per_sdu, const struct bt_audio_codec_cfg *);
+DECLARE_FAKE_VALUE_FUNC(const bt_addr_le_t *, ble_audio_hal_conn_get_dst, const struct bt_conn *);
+
+/* Resets every fake. Sent SDUs are released and the codec configuration
+ * reads back as 48 kHz, 10 ms, 120 octets and one frame per SDU.
+ */
+void ble_audio_hal_fakes_reset(void);
+
+#endif // BLE_AUDIO_HAL_FAKES_H
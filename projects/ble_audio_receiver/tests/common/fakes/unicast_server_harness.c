@@ -0,0 +1,168 @@
+// --- includes ----------------------------------------------------------------
+#include "unicast_server_harness.h"
+
+#include "ble_audio_hal_fakes.h"
+#include "ble_bap_unicast_server.h"
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+// --- defines -----------------------------------------------------------------
+#define ASE_COUNT (CONFIG_BT_ASCS_MAX_ASE_SNK_COUNT + CONFIG_BT_ASCS_MAX_ASE_SRC_COUNT)
+
+// --- static functions declarations -------------------------------------------
+static int  server_register_cb_custom(const struct bt_bap_unicast_server_cb *cb);
+static void stream_cb_register_custom(struct bt_bap_stream *stream, struct bt_bap_stream_ops *ops);
+
+// --- static variables definitions --------------------------------------------
+NET_BUF_POOL_FIXED_DEFINE(harness_rx_pool, 1, HARNESS_SDU_LEN, 8, NULL);
+
+static const struct bt_bap_unicast_server_cb *server_cb;
+static struct bt_bap_stream_ops              *stream_ops;
+static size_t                                 registered_streams;
+
+static struct bt_audio_codec_cfg codec_cfg;
+static struct bt_audio_codec_qos qos = {
+    .interval = HARNESS_SDU_INTERVAL_US,
+    .phy      = BT_GAP_LE_PHY_2M,
+    .sdu      = HARNESS_SDU_LEN,
+    .rtn      = CONFIG_BLE_BAP_RTN,
+    .latency  = 10U,
+    .pd       = CONFIG_BLE_BAP_PD_MAX_US,
+};
+
+static struct bt_bap_stream *configured[ASE_COUNT];
+static size_t                configured_count;
+static const uint8_t         silence[HARNESS_SDU_LEN];
+
+// --- static functions definitions --------------------------------------------
+static int
+server_register_cb_custom(const struct bt_bap_unicast_server_cb *cb)
+{
+    server_cb = cb;
+    return 0;
+}
+
+static void
+stream_cb_register_custom(struct bt_bap_stream *stream, struct bt_bap_stream_ops *ops)
+{
+    /* All streams share the same ops */
+    stream->ops = ops;
+    stream_ops  = ops;
+    registered_streams++;
+}
+
+// --- functions definitions ---------------------------------------------------
+void
+server_harness_init(void)
+{
+    ble_audio_hal_fakes_reset();
+    ble_audio_hal_server_register_cb_fake.custom_fake = server_register_cb_custom;
+    ble_audio_hal_stream_cb_register_fake.custom_fake = stream_cb_register_custom;
+
+    ble_bap_unicast_server_start();
+}
+
+const struct bt_bap_unicast_server_cb *
+server_harness_cb(void)
+{
+    return server_cb;
+}
+
+struct bt_bap_stream_ops *
+server_harness_stream_ops(void)
+{
+    return stream_ops;
+}
+
+size_t
+server_harness_registered_streams(void)
+{
+    return registered_streams;
+}
+
+const struct bt_audio_codec_qos *
+server_harness_qos(void)
+{
+    return &qos;
+}
+
+struct bt_bap_stream *
+server_harness_config(enum bt_audio_dir               dir,
+                      struct bt_audio_codec_qos_pref *pref,
+                      struct bt_bap_ascs_rsp         *rsp,
+                      int                            *err)
+{
+    struct bt_audio_codec_qos_pref local_pref = { 0 };
+    struct bt_bap_stream          *stream     = NULL;
+
+    *err = server_cb->config(NULL, NULL, dir, &codec_cfg, &stream, (pref != NULL) ? pref : &local_pref, rsp);
+    if (*err != 0)
+    {
+        return NULL;
+    }
+
+    /* Filled in by the stack once the ASE is configured */
+    stream->codec_cfg              = &codec_cfg;
+    stream->qos                    = &qos;
+    configured[configured_count++] = stream;
+
+    return stream;
+}
+
+void
+server_harness_stream(struct bt_bap_stream *stream)
+{
+    struct bt_bap_ascs_rsp rsp = { 0 };
+
+    zassert_ok(server_cb->qos(stream, &qos, &rsp));
+    zassert_ok(server_cb->enable(stream, NULL, 0, &rsp));
+    stream_ops->enabled(stream);
+    zassert_ok(server_cb->start(stream, &rsp));
+    stream_ops->started(stream);
+}
+
+void
+server_harness_release(struct bt_bap_stream *stream)
+{
+    struct bt_bap_ascs_rsp rsp = { 0 };
+
+    zassert_ok(server_cb->release(stream, &rsp));
+    stream_ops->released(stream);
+
+    for (size_t i = 0U; i < configured_count; i++)
+    {
+        if (configured[i] == stream)
+        {
+            configured[i] = configured[--configured_count];
+            break;
+        }
+    }
+}
+
+void
+server_harness_release_all(void)
+{
+    while (configured_count > 0U)
+    {
+        server_harness_release(configured[configured_count - 1U]);
+    }
+}
+
+void
+server_harness_sdu_recv(struct bt_bap_stream *stream, uint16_t seq_num, const uint8_t *data, bool valid)
+{
+    const struct bt_iso_recv_info info = {
+        .ts      = seq_num * HARNESS_SDU_INTERVAL_US,
+        .seq_num = seq_num,
+        .flags   = (valid ? BT_ISO_FLAGS_VALID : 0U) | BT_ISO_FLAGS_TS,
+    };
+    struct net_buf *buf = net_buf_alloc(&harness_rx_pool, K_NO_WAIT);
+
+    zassert_not_null(buf);
+    net_buf_add_mem(buf, (data != NULL) ? data : silence, HARNESS_SDU_LEN);
+
+    /* The stack keeps ownership of the buffer */
+    stream_ops->recv(stream, &info, buf);
+    net_buf_unref(buf);
+}
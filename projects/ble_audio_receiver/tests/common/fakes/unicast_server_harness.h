@@ -0,0 +1,41 @@
+#ifndef UNICAST_SERVER_HARNESS_H
+#define UNICAST_SERVER_HARNESS_H
+
+// --- includes ----------------------------------------------------------------
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/bluetooth/audio/bap.h>
+
+// --- defines -----------------------------------------------------------------
+/* Matches the codec configuration read back by the HAL fakes */
+#define HARNESS_SDU_INTERVAL_US 10000U
+#define HARNESS_SDU_LEN         120U
+
+// --- functions declarations --------------------------------------------------
+/* Resets the BT HAL fakes and starts the unicast server, capturing the
+ * callbacks it registers with the stack. Called once per suite, the codec
+ * HAL is left to the suite, faked or real.
+ */
+void server_harness_init(void);
+
+const struct bt_bap_unicast_server_cb *server_harness_cb(void);
+struct bt_bap_stream_ops              *server_harness_stream_ops(void);
+size_t                                 server_harness_registered_streams(void);
+const struct bt_audio_codec_qos       *server_harness_qos(void);
+
+/* Configures an ASE as the client would. pref may be NULL. */
+struct bt_bap_stream *server_harness_config(enum bt_audio_dir               dir,
+                                            struct bt_audio_codec_qos_pref *pref,
+                                            struct bt_bap_ascs_rsp         *rsp,
+                                            int                            *err);
+/* Runs a configured ASE through QoS configured, enabling and streaming */
+void                  server_harness_stream(struct bt_bap_stream *stream);
+void                  server_harness_release(struct bt_bap_stream *stream);
+/* Releases every ASE configured through the harness */
+void                  server_harness_release_all(void);
+
+/* Hands one SDU of HARNESS_SDU_LEN octets to the stream, silence when data is NULL */
+void server_harness_sdu_recv(struct bt_bap_stream *stream, uint16_t seq_num, const uint8_t *data, bool valid);
+
+#endif // UNICAST_SERVER_HARNESS_H
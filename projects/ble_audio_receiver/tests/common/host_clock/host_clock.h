@@ -0,0 +1,14 @@
+#ifndef HOST_CLOCK_H
+#define HOST_CLOCK_H
+
+// --- includes ----------------------------------------------------------------
+#include <stdint.h>
+
+// --- functions declarations --------------------------------------------------
+/* Host time for benchmarks on native_sim, where the simulated clock does not
+ * advance while code runs. Implemented on the runner side of the simulator.
+ */
+uint64_t host_clock_cycles(void);
+uint64_t host_clock_ns(void);
+
+#endif // HOST_CLOCK_H
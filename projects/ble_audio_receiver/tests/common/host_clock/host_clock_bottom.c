@@ -0,0 +1,28 @@
+// --- includes ----------------------------------------------------------------
+#include <stdint.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// --- functions definitions ---------------------------------------------------
+uint64_t
+host_clock_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+}
+
+uint64_t
+host_clock_cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    /* No cycle counter available to user space, fall back to nanoseconds */
+    return host_clock_ns();
+#endif
+}
@@ -0,0 +1,295 @@
+// --- includes ----------------------------------------------------------------
+#include "audio/audio_latency_ctrl.h"
+
+#include <zephyr/bluetooth/gap.h>
+#include <zephyr/bluetooth/iso.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/ztest.h>
+
+// --- logging settings --------------------------------------------------------
+LOG_MODULE_REGISTER(audio_m, LOG_LEVEL_INF);
+
+// --- defines -----------------------------------------------------------------
+#define STREAM_IDX      0U
+#define SDU_INTERVAL_US 10000U
+#define PD_US           CONFIG_BLE_BAP_PD_MAX_US
+#define PD_MIN_US       MIN(CONFIG_BLE_BAP_PD_MIN_US, PD_US)
+#define STEP_US         CONFIG_AUDIO_LATENCY_CTRL_STEP_US
+#define WINDOW          CONFIG_AUDIO_LATENCY_CTRL_WINDOW
+#define GOOD_WINDOWS    CONFIG_AUDIO_LATENCY_CTRL_GOOD_WINDOWS
+/* RTN after one lowering step, the controller does not go below 1 on its own */
+#define RTN_LOWERED     ((CONFIG_BLE_BAP_RTN > 1U) ? (CONFIG_BLE_BAP_RTN - 1U) : CONFIG_BLE_BAP_RTN)
+/* Decoded well ahead of the render time */
+#define DECODE_DELAY_US 2000U
+
+// --- structs -----------------------------------------------------------------
+/* ISO timeline of the stream under test */
+struct link_sim
+{
+    bt_addr_le_t peer;
+    uint16_t     seq_num;
+    uint32_t     ts;
+};
+
+// --- static functions declarations -------------------------------------------
+static void                           link_advance(void);
+static void                           sdu_deliver(bool valid, int32_t ts_offset_us, uint32_t decode_delay_us);
+static void                           windows_clean(uint32_t count);
+static struct bt_audio_codec_qos_pref qos_pref_learned(void);
+
+static void latency_ctrl_before(void *fixture);
+static void latency_ctrl_after(void *fixture);
+
+// --- static variables definitions --------------------------------------------
+static struct link_sim link;
+static uint8_t         peer_id;
+
+// --- static functions definitions --------------------------------------------
+static void
+link_advance(void)
+{
+    link.seq_num++;
+    link.ts += SDU_INTERVAL_US;
+}
+
+static void
+sdu_deliver(bool valid, int32_t ts_offset_us, uint32_t decode_delay_us)
+{
+    const uint8_t  flags = BT_ISO_FLAGS_TS | (valid ? BT_ISO_FLAGS_VALID : 0U);
+    const uint32_t ts    = link.ts + ts_offset_us;
+
+    /* A corrupted SDU is concealed by the decoder */
+    audio_latency_ctrl_sdu(STREAM_IDX, flags, link.seq_num, ts, valid ? 0 : 1, ts + decode_delay_us);
+    link_advance();
+}
+
+static void
+windows_clean(uint32_t count)
+{
+    for (uint32_t i = 0U; i < (count * WINDOW); i++)
+    {
+        sdu_deliver(true, 0, DECODE_DELAY_US);
+    }
+}
+
+static struct bt_audio_codec_qos_pref
+qos_pref_learned(void)
+{
+    struct bt_audio_codec_qos_pref pref = BT_AUDIO_CODEC_QOS_PREF(true,
+                                                                  BT_GAP_LE_PHY_2M,
+                                                                  CONFIG_BLE_BAP_RTN,
+                                                                  10,
+                                                                  CONFIG_BLE_BAP_PD_MIN_US,
+                                                                  CONFIG_BLE_BAP_PD_MAX_US,
+                                                                  CONFIG_BLE_BAP_PD_MAX_US,
+                                                                  CONFIG_BLE_BAP_PD_MAX_US);
+
+    /* The outcome is stored per peer when the stream stops */
+    audio_latency_ctrl_stream_stop(STREAM_IDX);
+    audio_latency_ctrl_qos_pref_get(&link.peer, &pref);
+
+    return pref;
+}
+
+static void
+latency_ctrl_before(void *fixture)
+{
+    ARG_UNUSED(fixture);
+
+    /* A new peer per test so that nothing is learned from a previous one */
+    link = (struct link_sim) {
+        .peer = { .type = BT_ADDR_LE_RANDOM, .a = { .val = { ++peer_id, 0x00, 0x00, 0x00, 0x00, 0xC0 } } },
+    };
+    audio_latency_ctrl_stream_start(STREAM_IDX, &link.peer, SDU_INTERVAL_US, PD_US);
+}
+
+static void
+latency_ctrl_after(void *fixture)
+{
+    ARG_UNUSED(fixture);
+
+    audio_latency_ctrl_stream_stop(STREAM_IDX);
+}
+
+ZTEST_SUITE(latency_ctrl, NULL, NULL, latency_ctrl_before, latency_ctrl_after, NULL);
+
+// --- test cases --------------------------------------------------------------
+ZTEST(latency_ctrl, test_start_is_conservative)
+{
+    zassert_equal(audio_latency_ctrl_render_delay_get(STREAM_IDX), PD_US);
+}
+
+ZTEST(latency_ctrl, test_clean_link_lowers_latency)
+{
+    struct bt_audio_codec_qos_pref pref;
+
+    windows_clean(GOOD_WINDOWS - 1U);
+    zassert_equal(audio_latency_ctrl_render_delay_get(STREAM_IDX), PD_US, "Lowered before the link proved stable");
+
+    windows_clean(1U);
+    zassert_equal(audio_latency_ctrl_render_delay_get(STREAM_IDX), PD_US - STEP_US);
+
+    pref = qos_pref_learned();
+    zassert_equal(pref.rtn, RTN_LOWERED);
+    zassert_equal(pref.pref_pd_min, PD_US - STEP_US);
+    zassert_equal(pref.pref_pd_max, PD_US - STEP_US);
+    zassert_equal(pref.pd_min, CONFIG_BLE_BAP_PD_MIN_US, "Mandatory range must not change");
+    zassert_equal(pref.pd_max, CONFIG_BLE_BAP_PD_MAX_US, "Mandatory range must not change");
+}
+
+ZTEST(latency_ctrl, test_clean_link_settles_at_pd_min)
+{
+    struct bt_audio_codec_qos_pref pref;
+
+    windows_clean(GOOD_WINDOWS * (((PD_US - PD_MIN_US) / STEP_US) + 2U));
+    zassert_equal(audio_latency_ctrl_render_delay_get(STREAM_IDX), PD_MIN_US);
+
+    pref = qos_pref_learned();
+    zassert_equal(pref.rtn, MIN(CONFIG_BLE_BAP_RTN, 1U));
+    zassert_equal(pref.pref_pd_min, PD_MIN_US);
+}
+
+ZTEST(latency_ctrl, test_decode_phase_is_not_an_underrun)
+{
+    /* The decode tick is not locked to SDU arrival, so SDUs are alternately
+     * decoded right away and a full interval later, as bursts of 0 and 2.
+     */
+    for (uint32_t i = 0U; i < (GOOD_WINDOWS * WINDOW); i++)
+    {
+        sdu_deliver(true, 0, ((i % 2U) == 0U) ? 0U : (SDU_INTERVAL_US - 1U));
+    }
+
+    zassert_equal(audio_latency_ctrl_render_delay_get(STREAM_IDX), PD_US - STEP_US);
+}
+
+ZTEST(latency_ctrl, test_bursty_loss_raises_latency)
+{
+    struct bt_audio_codec_qos_pref pref;
+
+    windows_clean(GOOD_WINDOWS);
+    zassert_equal(audio_latency_ctrl_render_delay_get(STREAM_IDX), PD_US - STEP_US);
+
+    /* Bursts of 2 lost SDUs every 20, 100 permill */
+    for (uint32_t i = 0U; i < WINDOW; i++)
+    {
+        if ((i % 20U) < 2U)
+        {
+            link_advance();
+        }
+        else
+        {
+            sdu_deliver(true, 0, DECODE_DELAY_US);
+        }
+    }
+
+    zassert_equal(audio_latency_ctrl_render_delay_get(STREAM_IDX), PD_US);
+
+    pref = qos_pref_learned();
+    zassert_equal(pref.rtn, RTN_LOWERED + 1U);
+    zassert_equal(pref.pref_pd_min, PD_US);
+}
+
+ZTEST(latency_ctrl, test_sustained_loss_saturates_rtn)
+{
+    struct bt_audio_codec_qos_pref pref;
+
+    /* 100 permill corrupted SDUs for long enough to reach the retransmission limit */
+    for (uint32_t i = 0U; i < ((CONFIG_AUDIO_LATENCY_CTRL_RTN_MAX + 2U) * WINDOW); i++)
+    {
+        sdu_deliver((i % 10U) != 0U, 0, DECODE_DELAY_US);
+    }
+
+    zassert_equal(audio_latency_ctrl_render_delay_get(STREAM_IDX), PD_US);
+
+    pref = qos_pref_learned();
+    zassert_equal(pref.rtn, CONFIG_AUDIO_LATENCY_CTRL_RTN_MAX);
+    zassert_equal(pref.pref_pd_min, PD_US);
+}
+
+ZTEST(latency_ctrl, test_moderate_loss_holds)
+{
+    struct bt_audio_codec_qos_pref pref;
+
+    /* 20 permill is neither good enough to lower nor bad enough to raise */
+    for (uint32_t i = 0U; i < (2U * GOOD_WINDOWS * WINDOW); i++)
+    {
+        sdu_deliver((i % 50U) != 0U, 0, DECODE_DELAY_US);
+    }
+
+    zassert_equal(audio_latency_ctrl_render_delay_get(STREAM_IDX), PD_US);
+
+    pref = qos_pref_learned();
+    zassert_equal(pref.rtn, CONFIG_BLE_BAP_RTN);
+}
+
+ZTEST(latency_ctrl, test_fair_window_restarts_good_streak)
+{
+    windows_clean(GOOD_WINDOWS - 1U);
+
+    for (uint32_t i = 0U; i < WINDOW; i++)
+    {
+        sdu_deliver((i % 50U) != 0U, 0, DECODE_DELAY_US);
+    }
+
+    windows_clean(GOOD_WINDOWS - 1U);
+    zassert_equal(audio_latency_ctrl_render_delay_get(STREAM_IDX), PD_US);
+
+    windows_clean(1U);
+    zassert_equal(audio_latency_ctrl_render_delay_get(STREAM_IDX), PD_US - STEP_US);
+}
+
+ZTEST(latency_ctrl, test_late_sdus_raise_latency)
+{
+    const uint32_t render_delay_us = PD_US - STEP_US;
+
+    windows_clean(GOOD_WINDOWS);
+    zassert_equal(audio_latency_ctrl_render_delay_get(STREAM_IDX), render_delay_us);
+
+    /* One SDU in ten decoded after its render time */
+    for (uint32_t i = 0U; i < WINDOW; i++)
+    {
+        sdu_deliver(true, 0, ((i % 10U) == 0U) ? (render_delay_us + 1U) : DECODE_DELAY_US);
+    }
+
+    zassert_equal(audio_latency_ctrl_render_delay_get(STREAM_IDX), PD_US);
+}
+
+ZTEST(latency_ctrl, test_jitter_raises_latency)
+{
+    windows_clean(GOOD_WINDOWS);
+    zassert_equal(audio_latency_ctrl_render_delay_get(STREAM_IDX), PD_US - STEP_US);
+
+    /* Reference points wander by more than a quarter of the SDU interval */
+    for (uint32_t i = 0U; i < WINDOW; i++)
+    {
+        sdu_deliver(true, ((i % 2U) == 0U) ? 0 : (int32_t)(SDU_INTERVAL_US / 3U), DECODE_DELAY_US);
+    }
+
+    zassert_equal(audio_latency_ctrl_render_delay_get(STREAM_IDX), PD_US);
+}
+
+ZTEST(latency_ctrl, test_learned_pref_is_restored)
+{
+    windows_clean(GOOD_WINDOWS);
+    audio_latency_ctrl_stream_stop(STREAM_IDX);
+
+    audio_latency_ctrl_stream_start(STREAM_IDX, &link.peer, SDU_INTERVAL_US, PD_US);
+    zassert_equal(audio_latency_ctrl_render_delay_get(STREAM_IDX), PD_US - STEP_US);
+}
+
+ZTEST(latency_ctrl, test_unknown_peer_keeps_pref)
+{
+    const bt_addr_le_t             unknown = { .type = BT_ADDR_LE_PUBLIC, .a = { .val = { 0xFF } } };
+    struct bt_audio_codec_qos_pref pref    = BT_AUDIO_CODEC_QOS_PREF(true,
+                                                                  BT_GAP_LE_PHY_2M,
+                                                                  CONFIG_BLE_BAP_RTN,
+                                                                  10,
+                                                                  CONFIG_BLE_BAP_PD_MIN_US,
+                                                                  CONFIG_BLE_BAP_PD_MAX_US,
+                                                                  CONFIG_BLE_BAP_PD_MAX_US,
+                                                                  CONFIG_BLE_BAP_PD_MAX_US);
+
+    audio_latency_ctrl_qos_pref_get(&unknown, &pref);
+    zassert_equal(pref.rtn, CONFIG_BLE_BAP_RTN);
+    zassert_equal(pref.pref_pd_min, CONFIG_BLE_BAP_PD_MAX_US);
+}
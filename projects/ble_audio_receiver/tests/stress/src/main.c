@@ -0,0 +1,246 @@
+// --- includes ----------------------------------------------------------------
+#include "audio/audio_codec_hal.h"
+#include "audio/audio_rx.h"
+#include "audio/audio_tx.h"
+#include "ble_audio_hal_fakes.h"
+#include "unicast_server_harness.h"
+
+#include <zephyr/fff.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/ztest.h>
+
+// --- logging settings --------------------------------------------------------
+LOG_MODULE_REGISTER(ble_m, LOG_LEVEL_INF);
+
+DEFINE_FFF_GLOBALS;
+
+// --- defines -----------------------------------------------------------------
+/* Same layout as the codec configuration read back by the HAL fakes */
+#define FREQ_HZ           48000
+#define FRAME_DURATION_US 10000
+#define FRAME_SAMPLES     ((FREQ_HZ / 1000) * (FRAME_DURATION_US / 1000))
+#define SDU_INTERVAL_US   HARNESS_SDU_INTERVAL_US
+#define SDU_LEN           HARNESS_SDU_LEN
+
+#define STRESS_INTERVALS 1000U
+/* Distinct LC3 SDUs, each sink starts at a different one */
+#define SDU_SET_COUNT    16U
+#define SDU_POOL_SIZE    (AUDIO_RX_STREAM_COUNT * CONFIG_AUDIO_RX_SDU_BUF_PER_STREAM)
+
+// --- static functions declarations -------------------------------------------
+static void pcm_generate(int16_t *pcm, uint32_t sdu, uint32_t *seed);
+static void sinks_recv(uint32_t intervals);
+
+static void *stress_setup(void);
+static void  stress_before(void *fixture);
+static void  stress_after(void *fixture);
+
+// --- static variables definitions --------------------------------------------
+static audio_encoder_mem_t encoder_mem;
+static uint8_t             sdu_set[SDU_SET_COUNT][SDU_LEN];
+
+static struct bt_bap_stream *sinks[AUDIO_RX_STREAM_COUNT];
+static struct bt_bap_stream *sources[AUDIO_TX_STREAM_COUNT];
+static uint16_t              seq_num;
+
+// --- static functions definitions --------------------------------------------
+static void
+pcm_generate(int16_t *pcm, uint32_t sdu, uint32_t *seed)
+{
+    /* Triangle wave with a period that changes per SDU, plus noise */
+    const int32_t period = 24 + (int32_t)(sdu % 40U);
+
+    for (int n = 0; n < FRAME_SAMPLES; n++)
+    {
+        const int32_t phase = n % period;
+        const int32_t tri   = ((phase < (period / 2)) ? phase : (period - phase)) * (16000 / period);
+
+        *seed  = (*seed * 1103515245U) + 12345U;
+        pcm[n] = (int16_t)(tri - 4000 + (int32_t)((*seed >> 16) % 2048U) - 1024);
+    }
+}
+
+static void
+sinks_recv(uint32_t intervals)
+{
+    for (uint32_t n = 0U; n < intervals; n++)
+    {
+        for (size_t i = 0U; i < ARRAY_SIZE(sinks); i++)
+        {
+            server_harness_sdu_recv(sinks[i], seq_num, sdu_set[(seq_num + i) % SDU_SET_COUNT], true);
+        }
+
+        seq_num++;
+        k_sleep(K_USEC(SDU_INTERVAL_US));
+    }
+
+    /* Let the last SDUs be decoded */
+    k_sleep(K_USEC(2U * SDU_INTERVAL_US));
+}
+
+static void *
+stress_setup(void)
+{
+    static int16_t pcm[FRAME_SAMPLES];
+    lc3_encoder_t  encoder;
+    uint32_t       seed = 1U;
+
+    /* Real LC3 SDUs, so that every stream decodes, conceals and encodes for real */
+    encoder = audio_codec_hal_encoder_setup(FRAME_DURATION_US, FREQ_HZ, &encoder_mem);
+    zassert_not_null(encoder);
+
+    for (uint32_t i = 0U; i < SDU_SET_COUNT; i++)
+    {
+        pcm_generate(pcm, i, &seed);
+        zassert_ok(audio_codec_hal_encode(encoder, pcm, SDU_LEN, sdu_set[i]));
+    }
+
+    server_harness_init();
+
+    return NULL;
+}
+
+static void
+stress_before(void *fixture)
+{
+    struct bt_bap_ascs_rsp rsp = { 0 };
+    int                    err;
+
+    ARG_UNUSED(fixture);
+
+    ble_audio_hal_fakes_reset();
+
+    /* Every context of both directions streams at once */
+    for (size_t i = 0U; i < ARRAY_SIZE(sinks); i++)
+    {
+        sinks[i] = server_harness_config(BT_AUDIO_DIR_SINK, NULL, &rsp, &err);
+        zassert_not_null(sinks[i]);
+        server_harness_stream(sinks[i]);
+    }
+
+    for (size_t i = 0U; i < ARRAY_SIZE(sources); i++)
+    {
+        sources[i] = server_harness_config(BT_AUDIO_DIR_SOURCE, NULL, &rsp, &err);
+        zassert_not_null(sources[i]);
+        server_harness_stream(sources[i]);
+    }
+
+    seq_num = 0U;
+}
+
+static void
+stress_after(void *fixture)
+{
+    ARG_UNUSED(fixture);
+
+    server_harness_release_all();
+}
+
+ZTEST_SUITE(stress, NULL, stress_setup, stress_before, stress_after, NULL);
+
+// --- test cases --------------------------------------------------------------
+ZTEST(stress, test_all_streams_clean)
+{
+    struct audio_rx_stats rx_stats;
+    struct audio_tx_stats tx_stats;
+    uint32_t              sent = 0U;
+
+    sinks_recv(STRESS_INTERVALS);
+
+    for (uint8_t i = 0U; i < AUDIO_RX_STREAM_COUNT; i++)
+    {
+        audio_rx_stats_get(i, &rx_stats);
+        zassert_equal(rx_stats.decoded_sdus, STRESS_INTERVALS, "Stream %u decoded %u SDUs", i, rx_stats.decoded_sdus);
+        zassert_equal(rx_stats.plc_frames, 0U, "Stream %u concealed frames", i);
+        zassert_equal(rx_stats.decode_errors, 0U, "Stream %u failed to decode", i);
+        zassert_equal(rx_stats.dropped_sdus, 0U, "Stream %u dropped SDUs", i);
+        zassert_equal(rx_stats.overruns, 0U, "Stream %u overran", i);
+    }
+
+    for (uint8_t i = 0U; i < AUDIO_TX_STREAM_COUNT; i++)
+    {
+        audio_tx_stats_get(i, &tx_stats);
+        zassert_true(tx_stats.sent_sdus >= STRESS_INTERVALS, "Stream %u sent %u SDUs", i, tx_stats.sent_sdus);
+        zassert_equal(tx_stats.skipped_sdus, 0U, "Stream %u skipped SDUs", i);
+        sent += tx_stats.sent_sdus;
+    }
+
+    zassert_equal(sent, ble_audio_hal_stream_send_fake.call_count);
+}
+
+ZTEST(stress, test_lost_sdus_stay_on_their_stream)
+{
+    struct audio_rx_stats rx_stats;
+    uint32_t              plc_streams = 0U;
+
+    /* Every tenth SDU of the first sink is lost */
+    for (uint32_t n = 0U; n < STRESS_INTERVALS; n++)
+    {
+        for (size_t i = 0U; i < ARRAY_SIZE(sinks); i++)
+        {
+            server_harness_sdu_recv(sinks[i],
+                                    seq_num,
+                                    sdu_set[(seq_num + i) % SDU_SET_COUNT],
+                                    (i != 0U) || ((n % 10U) != 0U));
+        }
+
+        seq_num++;
+        k_sleep(K_USEC(SDU_INTERVAL_US));
+    }
+
+    k_sleep(K_USEC(2U * SDU_INTERVAL_US));
+
+    for (uint8_t i = 0U; i < AUDIO_RX_STREAM_COUNT; i++)
+    {
+        audio_rx_stats_get(i, &rx_stats);
+        zassert_equal(rx_stats.decoded_sdus, STRESS_INTERVALS);
+        zassert_equal(rx_stats.decode_errors, 0U);
+        zassert_equal(rx_stats.dropped_sdus, 0U);
+
+        if (rx_stats.plc_frames != 0U)
+        {
+            zassert_equal(rx_stats.plc_frames, STRESS_INTERVALS / 10U);
+            plc_streams++;
+        }
+    }
+
+    zassert_equal(plc_streams, 1U, "Concealment leaked to other streams");
+}
+
+ZTEST(stress, test_full_pool_drops_on_flooding_stream)
+{
+    struct audio_rx_stats rx_stats;
+    uint32_t              dropped = 0U;
+
+    /* More SDUs of one sink within an interval than the whole pool holds */
+    for (uint32_t n = 0U; n < (SDU_POOL_SIZE + 5U); n++)
+    {
+        server_harness_sdu_recv(sinks[0], seq_num, sdu_set[seq_num % SDU_SET_COUNT], true);
+        seq_num++;
+    }
+
+    /* Other streams keep going once the backlog is decoded */
+    k_sleep(K_USEC(2U * SDU_INTERVAL_US));
+    sinks_recv(10U);
+
+    for (uint8_t i = 0U; i < AUDIO_RX_STREAM_COUNT; i++)
+    {
+        audio_rx_stats_get(i, &rx_stats);
+        zassert_equal(rx_stats.plc_frames, 0U);
+        zassert_equal(rx_stats.decode_errors, 0U);
+        dropped += rx_stats.dropped_sdus;
+
+        if (rx_stats.dropped_sdus != 0U)
+        {
+            zassert_equal(rx_stats.dropped_sdus, 5U);
+            zassert_equal(rx_stats.decoded_sdus, SDU_POOL_SIZE + 10U);
+        }
+        else
+        {
+            zassert_equal(rx_stats.decoded_sdus, 10U);
+        }
+    }
+
+    zassert_equal(dropped, 5U, "Drops charged to the wrong stream");
+}
@@ -0,0 +1,335 @@
+// --- includes ----------------------------------------------------------------
+#include "audio/audio_rx.h"
+#include "audio_codec_hal_fakes.h"
+#include "ble_audio_hal_fakes.h"
+#include "host_clock.h"
+#include "unicast_server_harness.h"
+
+#include <zephyr/fff.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/ztest.h>
+
+// --- logging settings --------------------------------------------------------
+LOG_MODULE_REGISTER(ble_m, LOG_LEVEL_INF);
+
+DEFINE_FFF_GLOBALS;
+
+// --- defines -----------------------------------------------------------------
+#define SINK_COUNT   CONFIG_BT_ASCS_MAX_ASE_SNK_COUNT
+#define SOURCE_COUNT CONFIG_BT_ASCS_MAX_ASE_SRC_COUNT
+#define ASE_COUNT    (SINK_COUNT + SOURCE_COUNT)
+
+#define SDU_INTERVAL_US HARNESS_SDU_INTERVAL_US
+#define SDU_LEN         HARNESS_SDU_LEN
+
+#define THROUGHPUT_SDU_COUNT 10000U
+/* SDUs received per SDU interval, half of the SDU pool */
+#define THROUGHPUT_BATCH     CONFIG_AUDIO_RX_SDU_BUF_PER_STREAM
+
+// --- static functions declarations -------------------------------------------
+static int decode_stall_custom(lc3_decoder_t decoder, const void *in, int nbytes, int16_t *pcm);
+
+static void *unicast_server_setup(void);
+static void  unicast_server_before(void *fixture);
+static void  unicast_server_after(void *fixture);
+
+// --- static variables definitions --------------------------------------------
+static bool decode_stall;
+
+// --- static functions definitions --------------------------------------------
+static int
+decode_stall_custom(lc3_decoder_t decoder, const void *in, int nbytes, int16_t *pcm)
+{
+    if (decode_stall)
+    {
+        /* One decode that takes longer than the whole SDU interval */
+        decode_stall = false;
+        k_busy_wait(SDU_INTERVAL_US + (SDU_INTERVAL_US / 2U));
+    }
+
+    return (in == NULL) ? 1 : 0;
+}
+
+static void *
+unicast_server_setup(void)
+{
+    audio_codec_hal_fakes_reset();
+    server_harness_init();
+
+    return NULL;
+}
+
+static void
+unicast_server_before(void *fixture)
+{
+    ARG_UNUSED(fixture);
+
+    ble_audio_hal_fakes_reset();
+    audio_codec_hal_fakes_reset();
+    FFF_RESET_HISTORY();
+}
+
+static void
+unicast_server_after(void *fixture)
+{
+    ARG_UNUSED(fixture);
+
+    /* Hand every ASE back so that the next test starts from idle */
+    server_harness_release_all();
+}
+
+ZTEST_SUITE(unicast_server, NULL, unicast_server_setup, unicast_server_before, unicast_server_after, NULL);
+
+// --- test cases --------------------------------------------------------------
+ZTEST(unicast_server, test_registered)
+{
+    zassert_not_null(server_harness_cb());
+    zassert_not_null(server_harness_stream_ops());
+    zassert_equal(server_harness_registered_streams(), ASE_COUNT, "Ops not registered on every ASE");
+}
+
+ZTEST(unicast_server, test_config_allocates_every_ase)
+{
+    struct bt_bap_stream  *streams[ASE_COUNT];
+    struct bt_bap_ascs_rsp rsp = { 0 };
+    int                    err;
+
+    for (size_t i = 0U; i < ASE_COUNT; i++)
+    {
+        streams[i] = server_harness_config((i < SINK_COUNT) ? BT_AUDIO_DIR_SINK : BT_AUDIO_DIR_SOURCE, NULL, &rsp, &err);
+        zassert_ok(err);
+        zassert_not_null(streams[i]);
+
+        for (size_t j = 0U; j < i; j++)
+        {
+            zassert_not_equal(streams[i], streams[j], "ASE %zu handed out twice", i);
+        }
+    }
+
+    zassert_is_null(server_harness_config(BT_AUDIO_DIR_SINK, NULL, &rsp, &err));
+    zassert_equal(err, -ENOMEM);
+    zassert_equal(rsp.code, BT_BAP_ASCS_RSP_CODE_NO_MEM);
+
+    zassert_is_null(server_harness_config(BT_AUDIO_DIR_SOURCE, NULL, &rsp, &err));
+    zassert_equal(err, -ENOMEM);
+}
+
+ZTEST(unicast_server, test_release_recycles_ase)
+{
+    struct bt_bap_ascs_rsp rsp = { 0 };
+    struct bt_bap_stream  *released;
+    int                    err;
+
+    released = server_harness_config(BT_AUDIO_DIR_SINK, NULL, &rsp, &err);
+    zassert_not_null(released);
+
+    for (size_t i = 1U; i < SINK_COUNT; i++)
+    {
+        zassert_not_null(server_harness_config(BT_AUDIO_DIR_SINK, NULL, &rsp, &err));
+    }
+
+    server_harness_release(released);
+
+    zassert_equal_ptr(server_harness_config(BT_AUDIO_DIR_SINK, NULL, &rsp, &err), released);
+}
+
+ZTEST(unicast_server, test_config_pref_for_new_peer)
+{
+    static const bt_addr_le_t      new_peer = { .type = BT_ADDR_LE_PUBLIC, .a = { .val = { 0xA5 } } };
+    struct bt_audio_codec_qos_pref pref     = { 0 };
+    struct bt_bap_ascs_rsp         rsp      = { 0 };
+    int                            err;
+
+    ble_audio_hal_conn_get_dst_fake.custom_fake = NULL;
+    ble_audio_hal_conn_get_dst_fake.return_val  = &new_peer;
+
+    zassert_not_null(server_harness_config(BT_AUDIO_DIR_SINK, &pref, &rsp, &err));
+
+    zassert_equal(pref.rtn, CONFIG_BLE_BAP_RTN);
+    zassert_equal(pref.pd_min, CONFIG_BLE_BAP_PD_MIN_US);
+    zassert_equal(pref.pd_max, CONFIG_BLE_BAP_PD_MAX_US);
+    zassert_equal(pref.pref_pd_max, CONFIG_BLE_BAP_PD_MAX_US);
+}
+
+ZTEST(unicast_server, test_enable_sets_up_codec)
+{
+    struct bt_bap_ascs_rsp rsp = { 0 };
+    struct bt_bap_stream  *sink;
+    struct bt_bap_stream  *source;
+    int                    err;
+
+    sink   = server_harness_config(BT_AUDIO_DIR_SINK, NULL, &rsp, &err);
+    source = server_harness_config(BT_AUDIO_DIR_SOURCE, NULL, &rsp, &err);
+    zassert_not_null(sink);
+    zassert_not_null(source);
+
+    zassert_ok(server_harness_cb()->qos(sink, server_harness_qos(), &rsp));
+    zassert_ok(server_harness_cb()->enable(sink, NULL, 0, &rsp));
+    zassert_equal(audio_codec_hal_decoder_setup_fake.call_count, 1U);
+    zassert_equal(audio_codec_hal_decoder_setup_fake.arg0_val, SDU_INTERVAL_US);
+    zassert_equal(audio_codec_hal_decoder_setup_fake.arg1_val, 48000);
+
+    zassert_ok(server_harness_cb()->qos(source, server_harness_qos(), &rsp));
+    zassert_ok(server_harness_cb()->enable(source, NULL, 0, &rsp));
+    zassert_equal(audio_codec_hal_encoder_setup_fake.call_count, 1U);
+    zassert_equal(audio_codec_hal_decoder_setup_fake.call_count, 1U, "Source set up a decoder");
+}
+
+ZTEST(unicast_server, test_enable_rejects_missing_freq)
+{
+    struct bt_bap_ascs_rsp rsp = { 0 };
+    struct bt_bap_stream  *sink;
+    int                    err;
+
+    sink = server_harness_config(BT_AUDIO_DIR_SINK, NULL, &rsp, &err);
+    zassert_not_null(sink);
+
+    ble_audio_hal_codec_cfg_get_freq_hz_fake.return_val = -ENODATA;
+
+    zassert_not_equal(server_harness_cb()->enable(sink, NULL, 0, &rsp), 0);
+    zassert_equal(rsp.code, BT_BAP_ASCS_RSP_CODE_CONF_INVALID);
+    zassert_equal(rsp.reason, BT_BAP_ASCS_REASON_CODEC_DATA);
+    zassert_equal(audio_codec_hal_decoder_setup_fake.call_count, 0U);
+}
+
+ZTEST(unicast_server, test_start_sink_only_by_server)
+{
+    struct bt_bap_ascs_rsp rsp = { 0 };
+    struct bt_bap_stream  *sink;
+    struct bt_bap_stream  *source;
+    int                    err;
+
+    sink   = server_harness_config(BT_AUDIO_DIR_SINK, NULL, &rsp, &err);
+    source = server_harness_config(BT_AUDIO_DIR_SOURCE, NULL, &rsp, &err);
+
+    /* The client starts source ASEs, the server starts sink ASEs */
+    server_harness_stream_ops()->enabled(source);
+    zassert_equal(ble_audio_hal_stream_start_fake.call_count, 0U);
+
+    server_harness_stream_ops()->enabled(sink);
+    zassert_equal(ble_audio_hal_stream_start_fake.call_count, 1U);
+    zassert_equal_ptr(ble_audio_hal_stream_start_fake.arg0_val, sink);
+
+    zassert_ok(server_harness_cb()->start(sink, &rsp));
+}
+
+ZTEST(unicast_server, test_recv_uses_stream_context)
+{
+    struct bt_bap_ascs_rsp rsp = { 0 };
+    struct bt_bap_stream  *sinks[SINK_COUNT];
+    int                    err;
+
+    for (size_t i = 0U; i < SINK_COUNT; i++)
+    {
+        sinks[i] = server_harness_config(BT_AUDIO_DIR_SINK, NULL, &rsp, &err);
+        zassert_not_null(sinks[i]);
+        server_harness_stream(sinks[i]);
+    }
+
+    /* Received in reverse order, each SDU must reach the decoder of its own ASE */
+    for (size_t i = 0U; i < SINK_COUNT; i++)
+    {
+        server_harness_sdu_recv(sinks[SINK_COUNT - 1U - i], 0U, NULL, true);
+    }
+
+    /* Let at least one SDU interval tick elapse */
+    k_sleep(K_USEC(2U * SDU_INTERVAL_US));
+
+    zassert_equal(audio_codec_hal_decode_fake.call_count, SINK_COUNT);
+    for (size_t i = 0U; i < SINK_COUNT; i++)
+    {
+        zassert_equal_ptr(audio_codec_hal_decode_fake.arg0_history[i],
+                          audio_codec_hal_decoder_setup_fake.arg2_history[SINK_COUNT - 1U - i],
+                          "SDU %zu decoded with the wrong context",
+                          i);
+    }
+}
+
+ZTEST(unicast_server, test_source_sends_on_its_stream)
+{
+    struct bt_bap_ascs_rsp rsp = { 0 };
+    struct bt_bap_stream  *source;
+    int                    err;
+
+    source = server_harness_config(BT_AUDIO_DIR_SOURCE, NULL, &rsp, &err);
+    zassert_not_null(source);
+    server_harness_stream(source);
+
+    k_sleep(K_USEC(2U * SDU_INTERVAL_US));
+
+    zassert_true(ble_audio_hal_stream_send_fake.call_count > 0U);
+    zassert_equal_ptr(ble_audio_hal_stream_send_fake.arg0_val, source);
+    zassert_equal(audio_codec_hal_encode_fake.arg2_val, SDU_LEN);
+}
+
+ZTEST(unicast_server, test_recv_throughput)
+{
+    struct bt_bap_ascs_rsp rsp = { 0 };
+    struct bt_bap_stream  *sinks[SINK_COUNT];
+    uint64_t               start_ns;
+    uint64_t               ns;
+    int                    err;
+
+    for (size_t i = 0U; i < SINK_COUNT; i++)
+    {
+        sinks[i] = server_harness_config(BT_AUDIO_DIR_SINK, NULL, &rsp, &err);
+        zassert_not_null(sinks[i]);
+        server_harness_stream(sinks[i]);
+    }
+
+    start_ns = host_clock_ns();
+
+    for (uint32_t n = 0U; n < THROUGHPUT_SDU_COUNT; n += THROUGHPUT_BATCH)
+    {
+        for (uint32_t i = n; i < MIN(n + THROUGHPUT_BATCH, THROUGHPUT_SDU_COUNT); i++)
+        {
+            server_harness_sdu_recv(sinks[i % SINK_COUNT], (uint16_t)(i / SINK_COUNT), NULL, true);
+        }
+
+        /* Decoded by the RX thread on the next SDU interval tick */
+        k_sleep(K_USEC(SDU_INTERVAL_US));
+    }
+
+    ns = host_clock_ns() - start_ns;
+
+    zassert_equal(audio_codec_hal_decode_fake.call_count, THROUGHPUT_SDU_COUNT, "SDUs were dropped");
+
+    TC_PRINT("unicast_server: %u SDUs in %llu us, %llu SDUs per second\n",
+             THROUGHPUT_SDU_COUNT,
+             (unsigned long long)(ns / 1000U),
+             (unsigned long long)((THROUGHPUT_SDU_COUNT * 1000000000ULL) / MAX(ns, 1U)));
+}
+
+ZTEST(unicast_server, test_late_burst_counts_overrun)
+{
+    struct bt_bap_ascs_rsp rsp = { 0 };
+    struct bt_bap_stream  *sinks[SINK_COUNT];
+    struct audio_rx_stats  stats;
+    int                    err;
+
+    for (size_t i = 0U; i < SINK_COUNT; i++)
+    {
+        sinks[i] = server_harness_config(BT_AUDIO_DIR_SINK, NULL, &rsp, &err);
+        zassert_not_null(sinks[i]);
+        server_harness_stream(sinks[i]);
+    }
+
+    audio_codec_hal_decode_fake.custom_fake = decode_stall_custom;
+    decode_stall                            = true;
+
+    for (size_t i = 0U; i < SINK_COUNT; i++)
+    {
+        server_harness_sdu_recv(sinks[i], 0U, NULL, true);
+    }
+
+    k_sleep(K_USEC(2U * SDU_INTERVAL_US));
+
+    /* Every sink had an SDU in the late burst */
+    for (uint8_t i = 0U; i < AUDIO_RX_STREAM_COUNT; i++)
+    {
+        audio_rx_stats_get(i, &stats);
+        zassert_equal(stats.overruns, 1U, "Stream %u overran %u times", i, stats.overruns);
+        zassert_equal(stats.decoded_sdus, 1U);
+    }
+}